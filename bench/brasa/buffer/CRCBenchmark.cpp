@@ -0,0 +1,70 @@
+#include <brasa/buffer/CRC.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using namespace brasa::buffer;
+
+using Crc32 = uint32_t (*)(const uint8_t*, size_t) noexcept;
+using IsSupported = bool (*)() noexcept;
+
+/** Returns @c true, for the implementations that run on any CPU. */
+bool always() noexcept {
+    return true;
+}
+
+/**
+ * Throughput of @p crc32 over buffers of `state.range(0)` bytes. Skipped if
+ * @p is_supported tells that the CPU lacks the instructions it needs.
+ */
+void crc32_bytes(benchmark::State& state, const Crc32 crc32, const IsSupported is_supported) {
+    if (not is_supported()) {
+        state.SkipWithError("instructions not supported by this CPU");
+        return;
+    }
+    std::vector<uint8_t> data(state.range(0));
+    std::iota(data.begin(), data.end(), uint8_t(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crc32(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(crc32_bytes, dispatch, &detail::crc32, &always)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, bytewise, &detail::crc32_bytewise, &always)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, slicing_by_8, &detail::crc32_slicing_by_8, &always)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, clmul, &detail::crc32_clmul, &detail::has_crc32_clmul)
+      ->RangeMultiplier(8)
+      ->Range(64, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, crc32c, &detail::crc32c, &always)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, crc32c_slicing_by_8, &detail::crc32c_slicing_by_8, &always)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+BENCHMARK_CAPTURE(crc32_bytes, crc32c_sse42, &detail::crc32c_sse42, &detail::has_crc32c_sse42)
+      ->RangeMultiplier(8)
+      ->Range(8, 1 << 20);
+
+/** Cost of the `crc32` of a key, as done when attaching to a buffer. */
+void crc32_key(benchmark::State& state) {
+    uint64_t key = 0x1234'5678'9abc'def0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detail::crc32(key));
+        ++key;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(crc32_key);
+} // namespace
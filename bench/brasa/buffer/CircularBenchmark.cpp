@@ -0,0 +1,235 @@
+#include <brasa/buffer/CircularMonitor.h>
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+#include <brasa/buffer/SharedRing.h>
+
+#include <benchmark/benchmark.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace brasa::buffer;
+
+constexpr uint64_t KEY = 0xc1ec;
+
+/** Element of @p SIZE bytes; the first word holds a sequence number. */
+template <std::size_t SIZE>
+struct Payload {
+    static_assert(SIZE % sizeof(uint64_t) == 0);
+    uint64_t words[SIZE / sizeof(uint64_t)];
+};
+
+/** Pins the calling thread to @p cpu. */
+void pin_to_cpu(const unsigned cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+}
+
+/** Adds the 50th, 99th and 99.9th percentiles of @p samples (in ns) to @p state. */
+void report_percentiles(benchmark::State& state, std::vector<uint64_t>& samples) {
+    if (samples.empty()) {
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto percentile = [&](const double p) {
+        return double(samples[std::size_t(p * double(samples.size() - 1))]);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+}
+
+uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+}
+
+/**
+ * Cost of a write followed by a read on the same thread, with hot caches. With
+ * @p BLOCKING the writer also pays the fence that lets readers block.
+ */
+template <typename TYPE, uint32_t N, bool BLOCKING = false>
+void write_read(benchmark::State& state) {
+    using Writer = CircularWriter<TYPE, N, detail::BufferData, BLOCKING>;
+    using Reader = CircularReader<TYPE, N, detail::BufferData, BLOCKING>;
+    std::vector<uint8_t> buffer(Writer::MIN_BUFFER_SIZE);
+    Writer writer(buffer.data(), KEY);
+    Reader reader(buffer.data(), KEY);
+    TYPE value{};
+    for (auto _ : state) {
+        ++value.words[0];
+        writer.write(value);
+        reader.read(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * sizeof(TYPE));
+}
+BENCHMARK_TEMPLATE(write_read, Payload<8>, 64);
+BENCHMARK_TEMPLATE(write_read, Payload<8>, 1024);
+BENCHMARK_TEMPLATE(write_read, Payload<8>, 1024, true);
+BENCHMARK_TEMPLATE(write_read, Payload<8>, 65536);
+BENCHMARK_TEMPLATE(write_read, Payload<64>, 1024);
+BENCHMARK_TEMPLATE(write_read, Payload<256>, 1024);
+
+/**
+ * Writer throughput while another thread drains the buffer. The writer never
+ * waits, so the counters also tell how much the reader could keep up with.
+ */
+template <typename TYPE, uint32_t N>
+void concurrent_write(benchmark::State& state) {
+    std::vector<uint8_t> buffer(CircularWriter<TYPE, N>::MIN_BUFFER_SIZE);
+    CircularWriter<TYPE, N> writer(buffer.data(), KEY);
+    const CircularMonitor<TYPE, N> monitor(buffer.data(), KEY);
+
+    std::atomic<bool> stop = false;
+    std::thread consumer([&] {
+        CircularReader<TYPE, N> reader(buffer.data(), KEY);
+        TYPE value;
+        while (not stop.load(std::memory_order_relaxed)) {
+            reader.read(value);
+        }
+    });
+
+    TYPE value{};
+    for (auto _ : state) {
+        ++value.words[0];
+        writer.write(value);
+    }
+    stop = true;
+    consumer.join();
+
+    const auto stats = monitor.stats();
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * sizeof(TYPE));
+    state.counters["read_ratio"] = double(stats.read) / double(stats.written);
+    state.counters["dropped_ratio"] = double(stats.dropped) / double(stats.written);
+}
+BENCHMARK_TEMPLATE(concurrent_write, Payload<8>, 1024)->UseRealTime();
+BENCHMARK_TEMPLATE(concurrent_write, Payload<64>, 1024)->UseRealTime();
+BENCHMARK_TEMPLATE(concurrent_write, Payload<256>, 1024)->UseRealTime();
+BENCHMARK_TEMPLATE(concurrent_write, Payload<64>, 65536)->UseRealTime();
+
+using Message = Payload<64>;
+constexpr uint32_t PING_N = 64;
+constexpr uint64_t STOP = ~uint64_t(0);
+
+/**
+ * Reads from @p ping and writes every message back to @p pong until the STOP
+ * message. Yields while waiting if @p yield is set, so that it can share a
+ * core with the other side.
+ */
+void echo(uint8_t* ping, uint8_t* pong, const bool yield) {
+    CircularReader<Message, PING_N> reader(ping, KEY);
+    CircularWriter<Message, PING_N> writer(pong, KEY);
+    Message message;
+    for (;;) {
+        while (not reader.read(message)) {
+            if (yield) {
+                std::this_thread::yield();
+            }
+        }
+        if (message.words[0] == STOP) {
+            return;
+        }
+        writer.write(message);
+    }
+}
+
+/**
+ * Round trips through a pair of buffers, timed one by one to report latency
+ * percentiles. Each message is written to @p ping and read back from @p pong.
+ */
+void round_trips(benchmark::State& state, uint8_t* ping, uint8_t* pong, const bool yield) {
+    CircularWriter<Message, PING_N> writer(ping, KEY);
+    CircularReader<Message, PING_N> reader(pong, KEY);
+    std::vector<uint64_t> samples;
+    samples.reserve(1'000'000);
+
+    Message message{};
+    for (auto _ : state) {
+        const auto begin = now_ns();
+        ++message.words[0];
+        writer.write(message);
+        while (not reader.read(message)) {
+            if (yield) {
+                std::this_thread::yield();
+            }
+        }
+        if (samples.size() < samples.capacity()) {
+            samples.push_back(now_ns() - begin);
+        }
+    }
+    message.words[0] = STOP;
+    writer.write(message);
+
+    state.SetItemsProcessed(state.iterations());
+    report_percentiles(state, samples);
+}
+
+/** Round trips between two threads of this process, on the same or on different cores. */
+void thread_round_trip(benchmark::State& state) {
+    const bool same_core = state.range(0) == 0;
+    if (not same_core && std::thread::hardware_concurrency() < 2) {
+        state.SkipWithError("not enough CPUs");
+        return;
+    }
+    cpu_set_t affinity;
+    ::pthread_getaffinity_np(::pthread_self(), sizeof(affinity), &affinity);
+    pin_to_cpu(0);
+
+    std::vector<uint8_t> ping(CircularWriter<Message, PING_N>::MIN_BUFFER_SIZE);
+    std::vector<uint8_t> pong(CircularWriter<Message, PING_N>::MIN_BUFFER_SIZE);
+    // initialised up front so that the two sides do not race to do it
+    CircularWriter<Message, PING_N>(ping.data(), KEY);
+    CircularWriter<Message, PING_N>(pong.data(), KEY);
+
+    std::thread other([&] {
+        pin_to_cpu(same_core ? 0 : 1);
+        echo(ping.data(), pong.data(), same_core);
+    });
+    round_trips(state, ping.data(), pong.data(), same_core);
+    other.join();
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(affinity), &affinity);
+    state.SetLabel(same_core ? "same core" : "cross core");
+}
+BENCHMARK(thread_round_trip)->Arg(0)->Arg(1)->UseRealTime();
+
+/** Round trips with a forked process through shared memory, as in the buffer demo. */
+void process_round_trip(benchmark::State& state) {
+    const auto name = "/brasa_bench_" + std::to_string(::getpid());
+    SharedRing<Message, PING_N> ping(name + "_ping");
+    SharedRing<Message, PING_N> pong(name + "_pong");
+    SharedRing<Message, PING_N>::unlink(ping.name());
+    SharedRing<Message, PING_N>::unlink(pong.name());
+    // initialised up front so that the two sides do not race to do it
+    CircularWriter<Message, PING_N>(ping.data(), KEY);
+    CircularWriter<Message, PING_N>(pong.data(), KEY);
+
+    const bool yield = std::thread::hardware_concurrency() < 2;
+    const auto pid = ::fork();
+    if (pid == 0) {
+        echo(ping.data(), pong.data(), yield);
+        ::_exit(0);
+    }
+    round_trips(state, ping.data(), pong.data(), yield);
+    ::waitpid(pid, nullptr, 0);
+    state.SetLabel("cross process");
+}
+BENCHMARK(process_round_trip)->UseRealTime();
+} // namespace
@@ -0,0 +1,47 @@
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+#include <brasa/buffer/DynamicCircularReader.h>
+#include <brasa/buffer/DynamicCircularWriter.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace brasa::buffer;
+
+constexpr uint64_t KEY = 0xd1ca;
+constexpr uint32_t N = 1024;
+
+/** Writes and reads back one element per iteration with the compile-time capacity buffer. */
+void circular_write_read(benchmark::State& state) {
+    std::vector<uint8_t> buffer(CircularWriter<uint64_t, N>::MIN_BUFFER_SIZE);
+    CircularWriter<uint64_t, N> writer(buffer.data(), KEY);
+    CircularReader<uint64_t, N> reader(buffer.data(), KEY);
+    uint64_t value = 0;
+    for (auto _ : state) {
+        writer.write(value);
+        reader.read(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(circular_write_read);
+
+/** Same as `circular_write_read` with the runtime capacity buffer. */
+void dynamic_circular_write_read(benchmark::State& state) {
+    std::vector<uint8_t> buffer(DynamicCircularWriter<uint64_t>::min_buffer_size(N));
+    DynamicCircularWriter<uint64_t> writer(buffer.data(), N, KEY);
+    DynamicCircularReader<uint64_t> reader(buffer.data(), KEY);
+    uint64_t value = 0;
+    for (auto _ : state) {
+        writer.write(value);
+        reader.read(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(dynamic_circular_write_read);
+} // namespace
@@ -0,0 +1,111 @@
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+#include <brasa/buffer/SequencedReader.h>
+#include <brasa/buffer/SequencedWriter.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+using namespace brasa::buffer;
+
+constexpr uint64_t KEY = 0xbe7c;
+constexpr uint32_t N = 1024;
+
+struct Message {
+    uint64_t producer;
+    uint64_t sequence;
+};
+
+/**
+ * Single consumer draining the buffer in the background while the benchmark
+ * threads produce. It is started and stopped by the first benchmark thread,
+ * outside of the timed loop (all threads wait for each other at its bounds).
+ */
+template <typename READER>
+class Consumer {
+public:
+    explicit Consumer(uint8_t* buffer)
+          : thread_([this, buffer] {
+                READER reader(buffer, KEY);
+                Message message;
+                while (not stop_.load(std::memory_order_relaxed)) {
+                    if (not reader.read(message)) {
+                        std::this_thread::yield();
+                    }
+                }
+                while (reader.read(message)) {
+                }
+            }) {}
+
+    ~Consumer() {
+        stop_ = true;
+        thread_.join();
+    }
+
+private:
+    std::atomic<bool> stop_ = false;
+    std::thread thread_;
+};
+
+/** Every benchmark thread is a producer retrying while the buffer is full. */
+void sequenced_write(benchmark::State& state) {
+    static uint8_t buffer[SequencedWriter<Message, N>::MIN_BUFFER_SIZE];
+    static std::unique_ptr<Consumer<SequencedReader<Message, N>>> consumer;
+    if (state.thread_index() == 0) {
+        SequencedWriter<Message, N> initializer(buffer, KEY);
+        consumer = std::make_unique<Consumer<SequencedReader<Message, N>>>(buffer);
+    }
+
+    SequencedWriter<Message, N> writer(buffer, KEY);
+    const uint64_t producer = state.thread_index();
+    uint64_t sequence = 0;
+    for (auto _ : state) {
+        while (not writer.write({ producer, sequence })) {
+            std::this_thread::yield();
+        }
+        ++sequence;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        consumer.reset();
+    }
+}
+BENCHMARK(sequenced_write)->ThreadRange(1, 64)->UseRealTime();
+
+/**
+ * Baseline: the single-writer `CircularWriter` shared by all benchmark threads
+ * behind a mutex.
+ */
+void locked_circular_write(benchmark::State& state) {
+    static uint8_t buffer[CircularWriter<Message, N>::MIN_BUFFER_SIZE];
+    static std::unique_ptr<CircularWriter<Message, N>> writer;
+    static std::unique_ptr<Consumer<CircularReader<Message, N>>> consumer;
+    static std::mutex mutex;
+    if (state.thread_index() == 0) {
+        writer = std::make_unique<CircularWriter<Message, N>>(buffer, KEY);
+        consumer = std::make_unique<Consumer<CircularReader<Message, N>>>(buffer);
+    }
+
+    const uint64_t producer = state.thread_index();
+    uint64_t sequence = 0;
+    for (auto _ : state) {
+        const std::lock_guard lock(mutex);
+        writer->write({ producer, sequence++ });
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        consumer.reset();
+        writer.reset();
+    }
+}
+BENCHMARK(locked_circular_write)->ThreadRange(1, 64)->UseRealTime();
+} // namespace
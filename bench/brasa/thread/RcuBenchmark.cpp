@@ -0,0 +1,49 @@
+#include <brasa/chronus/Now.h>
+#include <brasa/thread/Rcu.h>
+#include <brasa/thread/RcuBatch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using brasa::thread::make_rcu_batch;
+using brasa::thread::Rcu;
+
+/** Cost of a read (taking and releasing a reader) with several threads reading at once. */
+void rcu_read(benchmark::State& state) {
+    static Rcu<std::vector<int>> rcu(std::vector<int>(16, 1));
+    for (auto _ : state) {
+        const auto reader = rcu.read();
+        benchmark::DoNotOptimize(reader.value().data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_read)->ThreadRange(1, 8)->UseRealTime();
+
+/** Cost of a write of a value of `state.range(0)` bytes, with no reader. */
+void rcu_write(benchmark::State& state) {
+    Rcu<std::string> rcu(std::string(state.range(0), 'a'));
+    char c = 'a';
+    for (auto _ : state) {
+        auto writer = rcu.write();
+        writer.value()[0] = ++c;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_write)->RangeMultiplier(32)->Range(16, 1 << 20);
+
+/** Cost of a small change to a 32 KiB value, published in batches of `state.range(0)`. */
+void rcu_batched_write(benchmark::State& state) {
+    Rcu<std::string> rcu(std::string(32 * 1024, 'a'));
+    auto batch = make_rcu_batch(rcu, brasa::chronus::micro_now, 1000, state.range(0));
+    char c = 'a';
+    for (auto _ : state) {
+        batch.push([c = ++c](std::string& value) { value[0] = c; });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_batched_write)->RangeMultiplier(8)->Range(1, 512);
+} // namespace
@@ -1,16 +1,11 @@
-#include <brasa/buffer/CircularReader.h>
-#include <brasa/buffer/CircularWriter.h>
+#include <brasa/buffer/SharedRing.h>
 #include <brasa/chronus/Now.h>
 #include <brasa/chronus/SleepStd.h>
 #include <brasa/chronus/Waiter.h>
 
-#include <fcntl.h>
-#include <sys/mman.h>
-#include <sys/shm.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
-#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <vector>
@@ -25,8 +20,10 @@ struct ElapsedTime {
 constexpr uint64_t BUFFER_KEY = 0xf1ab'25e3'3562'abde; // some arbitrary unique key
 
 constexpr size_t ELEMENTS = 1500;
-constexpr size_t BUFFER_SIZE =
-      brasa::buffer::CircularWriter<ElapsedTime, ELEMENTS>::MIN_BUFFER_SIZE;
+using SharedRing = brasa::buffer::SharedRing<ElapsedTime, ELEMENTS>;
+
+// name of the shared memory segment holding the buffer
+constexpr const char SHM_NAME[] = "/CIRCULAR_BUFFER";
 
 // 2 laps and ten more elements
 constexpr size_t NUM_WRITES = 2 * ELEMENTS + 10;
@@ -37,12 +34,11 @@ std::ostream& operator<<(std::ostream& out, const ElapsedTime& elapsed) {
 }
 
 // produces information to be shared with the consumer
-void producer(uint8_t* buffer) {
+void producer(SharedRing& ring) {
     std::cout << "Entered producer\n";
-    using CircularWriter = brasa::buffer::CircularWriter<ElapsedTime, ELEMENTS>;
 
     // Create a writer to put the shared information into it
-    CircularWriter writer(buffer, BUFFER_KEY);
+    auto writer = ring.writer(BUFFER_KEY);
 
     // measurements are made in microseconds
     auto begin = brasa::chronus::micro_now();
@@ -63,29 +59,35 @@ void producer(uint8_t* buffer) {
 }
 
 // consumes information shared from the producer
-void consumer(uint8_t* buffer) {
+void consumer(SharedRing& ring) {
     std::cout << "Entered consumer\n";
-    using CircularReader = brasa::buffer::CircularReader<ElapsedTime, ELEMENTS>;
 
     // this will hold the timings
     std::vector<ElapsedTime> timings;
     timings.reserve(NUM_WRITES);
 
-    CircularReader reader(buffer, BUFFER_KEY);
+    auto reader = ring.reader(BUFFER_KEY);
 
     size_t discarded = 0;
+    size_t total_dropped = 0;
     ElapsedTime elapsed;
 
     // consumption has to be faster than production, to avoid dirty reads
     brasa::chronus::Waiter waiter =
           brasa::chronus::make_waiter(brasa::chronus::nano_now, 1000, brasa::chronus::nano_sleep);
-    for (size_t i = 0; i < NUM_WRITES; ++i) {
+    while (timings.size() + total_dropped < NUM_WRITES) {
         discarded = 0;
         waiter.reset();
-        while (not reader.read(elapsed)) {
+        // the reader tells how many measurements were overwritten before being read
+        size_t dropped = 0;
+        while (not reader.read(elapsed, dropped)) {
             ++discarded;
             waiter.wait();
         }
+        if (dropped != 0) {
+            std::cout << dropped << " dropped before " << elapsed << "\n";
+            total_dropped += dropped;
+        }
         timings.push_back(elapsed);
     }
 
@@ -97,44 +99,20 @@ void consumer(uint8_t* buffer) {
     };
     double total = std::accumulate(timings.begin(), timings.end(), uint64_t(0), sum_elapsed);
     std::cout << "Average time elapsed: " << total / timings.size() << " us\n";
-
-    size_t num_skipped = 0;
-    for (size_t i = 0; i < timings.size(); ++i) {
-        const auto& elapsed = timings[i];
-        if (elapsed.count != i + num_skipped) {
-            std::cout << i + num_skipped << " != " << elapsed << "\n";
-            num_skipped = elapsed.count - i;
-        }
-    }
+    std::cout << "Number of dropped measurements: " << total_dropped << "\n";
     std::cout << "Leaving consumer\n";
 }
 
 int main() {
-    // create a memory to be shared between producer and consumer
-    constexpr const char shm_name[] = "/CIRCULAR_BUFFER";
-    const int shm_fd = shm_open(shm_name, O_RDWR | O_CREAT, 0666);
-    if (shm_fd == -1) {
-        std::cerr << "Error creating shared memory: " << strerror(errno) << "\n";
-        return 1;
-    }
-
-    // resize the shared memory to the buffer size
-    if (ftruncate(shm_fd, BUFFER_SIZE) != 0) {
-        std::cerr << "Error truncating: " << strerror(errno) << "\n";
-        shm_unlink(shm_name);
-        return 1;
-    }
+    // creates the shared memory before forking, pre-faulting its pages, so that both children
+    // inherit the mapping of an existing segment
+    SharedRing ring(SHM_NAME, { .populate = true });
 
     // forks the producer
     const int write_pid = fork();
     if (write_pid == 0) {
         std::cout << "Write child\n";
-        void* ptr = mmap(nullptr, BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
-        if (ptr == MAP_FAILED) {
-            std::cerr << "Error write mmap: " << strerror(errno) << "\n";
-            return 1;
-        }
-        producer(static_cast<uint8_t*>(ptr));
+        producer(ring);
         return 0;
     }
 
@@ -146,12 +124,7 @@ int main() {
     if (read_pid == 0) {
         brasa::chronus::milli_sleep(1);
         std::cout << "Read child\n";
-        void* ptr = mmap(nullptr, BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
-        if (ptr == MAP_FAILED) {
-            std::cerr << "Error read mmap: " << strerror(errno) << "\n";
-            return 1;
-        }
-        consumer(static_cast<uint8_t*>(ptr));
+        consumer(ring);
         return 0;
     }
 
@@ -161,5 +134,5 @@ int main() {
     waitpid(read_pid, &status, 0);
 
     // delete the shared memory
-    shm_unlink(shm_name);
+    SharedRing::unlink(SHM_NAME);
 }
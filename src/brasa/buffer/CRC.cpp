@@ -1,86 +1,377 @@
 #include <brasa/buffer/CRC.h>
 
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 namespace brasa::buffer::detail {
 
 namespace {
-// clang-format off
-// see https://rosettacode.org/wiki/CRC-32
-constexpr uint32_t CRC_TABLE[] = {
-    0x00000000U, 0x77073096U, 0xee0e612cU, 0x990951baU, 0x076dc419U, 0x706af48fU, 0xe963a535U, 0x9e6495a3U,
-    0x0edb8832U, 0x79dcb8a4U, 0xe0d5e91eU, 0x97d2d988U, 0x09b64c2bU, 0x7eb17cbdU, 0xe7b82d07U, 0x90bf1d91U,
-    0x1db71064U, 0x6ab020f2U, 0xf3b97148U, 0x84be41deU, 0x1adad47dU, 0x6ddde4ebU, 0xf4d4b551U, 0x83d385c7U,
-    0x136c9856U, 0x646ba8c0U, 0xfd62f97aU, 0x8a65c9ecU, 0x14015c4fU, 0x63066cd9U, 0xfa0f3d63U, 0x8d080df5U,
-    0x3b6e20c8U, 0x4c69105eU, 0xd56041e4U, 0xa2677172U, 0x3c03e4d1U, 0x4b04d447U, 0xd20d85fdU, 0xa50ab56bU,
-    0x35b5a8faU, 0x42b2986cU, 0xdbbbc9d6U, 0xacbcf940U, 0x32d86ce3U, 0x45df5c75U, 0xdcd60dcfU, 0xabd13d59U,
-    0x26d930acU, 0x51de003aU, 0xc8d75180U, 0xbfd06116U, 0x21b4f4b5U, 0x56b3c423U, 0xcfba9599U, 0xb8bda50fU,
-    0x2802b89eU, 0x5f058808U, 0xc60cd9b2U, 0xb10be924U, 0x2f6f7c87U, 0x58684c11U, 0xc1611dabU, 0xb6662d3dU,
-    0x76dc4190U, 0x01db7106U, 0x98d220bcU, 0xefd5102aU, 0x71b18589U, 0x06b6b51fU, 0x9fbfe4a5U, 0xe8b8d433U,
-    0x7807c9a2U, 0x0f00f934U, 0x9609a88eU, 0xe10e9818U, 0x7f6a0dbbU, 0x086d3d2dU, 0x91646c97U, 0xe6635c01U,
-    0x6b6b51f4U, 0x1c6c6162U, 0x856530d8U, 0xf262004eU, 0x6c0695edU, 0x1b01a57bU, 0x8208f4c1U, 0xf50fc457U,
-    0x65b0d9c6U, 0x12b7e950U, 0x8bbeb8eaU, 0xfcb9887cU, 0x62dd1ddfU, 0x15da2d49U, 0x8cd37cf3U, 0xfbd44c65U,
-    0x4db26158U, 0x3ab551ceU, 0xa3bc0074U, 0xd4bb30e2U, 0x4adfa541U, 0x3dd895d7U, 0xa4d1c46dU, 0xd3d6f4fbU,
-    0x4369e96aU, 0x346ed9fcU, 0xad678846U, 0xda60b8d0U, 0x44042d73U, 0x33031de5U, 0xaa0a4c5fU, 0xdd0d7cc9U,
-    0x5005713cU, 0x270241aaU, 0xbe0b1010U, 0xc90c2086U, 0x5768b525U, 0x206f85b3U, 0xb966d409U, 0xce61e49fU,
-    0x5edef90eU, 0x29d9c998U, 0xb0d09822U, 0xc7d7a8b4U, 0x59b33d17U, 0x2eb40d81U, 0xb7bd5c3bU, 0xc0ba6cadU,
-    0xedb88320U, 0x9abfb3b6U, 0x03b6e20cU, 0x74b1d29aU, 0xead54739U, 0x9dd277afU, 0x04db2615U, 0x73dc1683U,
-    0xe3630b12U, 0x94643b84U, 0x0d6d6a3eU, 0x7a6a5aa8U, 0xe40ecf0bU, 0x9309ff9dU, 0x0a00ae27U, 0x7d079eb1U,
-    0xf00f9344U, 0x8708a3d2U, 0x1e01f268U, 0x6906c2feU, 0xf762575dU, 0x806567cbU, 0x196c3671U, 0x6e6b06e7U,
-    0xfed41b76U, 0x89d32be0U, 0x10da7a5aU, 0x67dd4accU, 0xf9b9df6fU, 0x8ebeeff9U, 0x17b7be43U, 0x60b08ed5U,
-    0xd6d6a3e8U, 0xa1d1937eU, 0x38d8c2c4U, 0x4fdff252U, 0xd1bb67f1U, 0xa6bc5767U, 0x3fb506ddU, 0x48b2364bU,
-    0xd80d2bdaU, 0xaf0a1b4cU, 0x36034af6U, 0x41047a60U, 0xdf60efc3U, 0xa867df55U, 0x316e8eefU, 0x4669be79U,
-    0xcb61b38cU, 0xbc66831aU, 0x256fd2a0U, 0x5268e236U, 0xcc0c7795U, 0xbb0b4703U, 0x220216b9U, 0x5505262fU,
-    0xc5ba3bbeU, 0xb2bd0b28U, 0x2bb45a92U, 0x5cb36a04U, 0xc2d7ffa7U, 0xb5d0cf31U, 0x2cd99e8bU, 0x5bdeae1dU,
-    0x9b64c2b0U, 0xec63f226U, 0x756aa39cU, 0x026d930aU, 0x9c0906a9U, 0xeb0e363fU, 0x72076785U, 0x05005713U,
-    0x95bf4a82U, 0xe2b87a14U, 0x7bb12baeU, 0x0cb61b38U, 0x92d28e9bU, 0xe5d5be0dU, 0x7cdcefb7U, 0x0bdbdf21U,
-    0x86d3d2d4U, 0xf1d4e242U, 0x68ddb3f8U, 0x1fda836eU, 0x81be16cdU, 0xf6b9265bU, 0x6fb077e1U, 0x18b74777U,
-    0x88085ae6U, 0xff0f6a70U, 0x66063bcaU, 0x11010b5cU, 0x8f659effU, 0xf862ae69U, 0x616bffd3U, 0x166ccf45U,
-    0xa00ae278U, 0xd70dd2eeU, 0x4e048354U, 0x3903b3c2U, 0xa7672661U, 0xd06016f7U, 0x4969474dU, 0x3e6e77dbU,
-    0xaed16a4aU, 0xd9d65adcU, 0x40df0b66U, 0x37d83bf0U, 0xa9bcae53U, 0xdebb9ec5U, 0x47b2cf7fU, 0x30b5ffe9U,
-    0xbdbdf21cU, 0xcabac28aU, 0x53b39330U, 0x24b4a3a6U, 0xbad03605U, 0xcdd70693U, 0x54de5729U, 0x23d967bfU,
-    0xb3667a2eU, 0xc4614ab8U, 0x5d681b02U, 0x2a6f2b94U, 0xb40bbe37U, 0xc30c8ea1U, 0x5a05df1bU, 0x2d02ef8dU,
-};
-static_assert(sizeof(CRC_TABLE) == 256 * sizeof(uint32_t), "CRC_TABLE needs to have 256 elements");
-}
-}
-
-#define DO1(_buf, _crc) _crc = CRC_TABLE[((int)_crc ^ (*_buf++)) & 0xff] ^ (_crc >> 8);
-#define DO2(_buf, _crc)  DO1(_buf, _crc); DO1(_buf, _crc);
-#define DO4(_buf, _crc)  DO2(_buf, _crc); DO2(_buf, _crc);
-#define DO8(_buf, _crc)  DO4(_buf, _crc); DO4(_buf, _crc);
-// clang-format on
-
-/// calculates the CRC-32 of the buffer
-uint32_t brasa::buffer::detail::crc32(const uint8_t* buf, size_t len) noexcept {
-    uint32_t crc = 0xFFFF'FFFF;
-    while (len >= 8) {
-        DO8(buf, crc);
-        len -= 8;
-    }
-    if (len) {
-        do {
-            DO1(buf, crc);
-        } while (--len);
-    }
-    return crc ^ 0xffff'ffff;
-}
-
-/// calculates the CRC-32 of the number passed
-uint32_t brasa::buffer::detail::crc32(uint64_t value) noexcept {
-    uint32_t crc = 0xFFFF'FFFF;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    value >>= 8;
-    crc = CRC_TABLE[(crc ^ (value & 0xff)) & 0xff] ^ (crc >> 8);
-    return crc ^ 0xffff'ffff;
+using Table = std::array<uint32_t, 256>;
+
+/**
+ * Tables for slicing-by-8: `slices[k][b]` is the CRC of byte @p b followed by
+ * @p k zero bytes, so that 8 bytes are folded with 8 independent lookups.
+ */
+using Slices = std::array<Table, 8>;
+
+/** Returns the slicing-by-8 tables extending the byte-wise @p table. */
+constexpr Slices make_slices(const Table& table) {
+    Slices slices{ table };
+    for (size_t k = 1; k < slices.size(); ++k) {
+        for (size_t b = 0; b < table.size(); ++b) {
+            const auto previous = slices[k - 1][b];
+            slices[k][b] = (previous >> 8) ^ table[previous & 0xff];
+        }
+    }
+    return slices;
+}
+
+constexpr auto SLICES = make_slices(Crc32IsoHdlc::TABLE);
+constexpr auto C_SLICES = make_slices(Crc32Iscsi::TABLE);
+// spot checks against https://rosettacode.org/wiki/CRC-32
+static_assert(SLICES[0][1] == 0x7707'3096 && SLICES[0][255] == 0x2d02'ef8d);
+
+/** Folds one byte into the (non-inverted) @p crc. */
+inline uint32_t update(const Slices& slices, const uint32_t crc, const uint8_t byte) noexcept {
+    return slices[0][(crc ^ byte) & 0xff] ^ (crc >> 8);
+}
+
+/** Folds 8 bytes, as a little-endian @p word, into the (non-inverted) @p crc. */
+constexpr uint32_t update(const Slices& slices, const uint32_t crc, uint64_t word) noexcept {
+    word ^= crc;
+    return slices[7][word & 0xff] ^ slices[6][(word >> 8) & 0xff]
+           ^ slices[5][(word >> 16) & 0xff] ^ slices[4][(word >> 24) & 0xff]
+           ^ slices[3][(word >> 32) & 0xff] ^ slices[2][(word >> 40) & 0xff]
+           ^ slices[1][(word >> 48) & 0xff] ^ slices[0][word >> 56];
+}
+
+uint32_t update_bytewise(
+      const Slices& slices,
+      uint32_t crc,
+      const uint8_t* buf,
+      size_t len) noexcept {
+    for (; len != 0; --len) {
+        crc = update(slices, crc, *buf++);
+    }
+    return crc;
+}
+
+uint32_t update_slicing_by_8(
+      const Slices& slices,
+      uint32_t crc,
+      const uint8_t* buf,
+      size_t len) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t), buf += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, buf, sizeof(word));
+            crc = update(slices, crc, word);
+        }
+    }
+    return update_bytewise(slices, crc, buf, len);
+}
+
+#if defined(__x86_64__)
+#define BRASA_CLMUL [[gnu::target("pclmul,sse4.1")]]
+
+BRASA_CLMUL inline __m128i load(const uint8_t* buf) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf));
+}
+
+/** Multiplies both halves of @p x by the constants in @p k and adds them up. */
+BRASA_CLMUL inline __m128i fold(const __m128i x, const __m128i k) noexcept {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/**
+ * Folds @p buf into the (non-inverted) @p crc with carry-less multiplications,
+ * 64 bytes per iteration, then reduces the 128-bit remainder with a Barrett
+ * reduction; the tail is left to slicing-by-8. Constants and algorithm from
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * (Intel, 2009), for the bit-reflected CRC-32 polynomial, as in the Linux
+ * kernel.
+ */
+BRASA_CLMUL uint32_t update_clmul(uint32_t crc, const uint8_t* buf, size_t len) noexcept {
+    if (len < 64) {
+        return update_slicing_by_8(SLICES, crc, buf, len);
+    }
+    const auto k1k2 = _mm_set_epi64x(0x1'c6e4'1596, 0x1'5444'2bd4);
+    const auto k3k4 = _mm_set_epi64x(0x0'ccaa'009e, 0x1'7519'97d0);
+    const auto k5 = _mm_set_epi64x(0, 0x1'63cd'6124);
+    const auto poly = _mm_set_epi64x(0x1'f701'1641, 0x1'db71'0641);
+    const auto mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+    auto x1 = _mm_xor_si128(load(buf), _mm_cvtsi32_si128(int(crc)));
+    auto x2 = load(buf + 16);
+    auto x3 = load(buf + 32);
+    auto x4 = load(buf + 48);
+    for (buf += 64, len -= 64; len >= 64; buf += 64, len -= 64) {
+        x1 = _mm_xor_si128(fold(x1, k1k2), load(buf));
+        x2 = _mm_xor_si128(fold(x2, k1k2), load(buf + 16));
+        x3 = _mm_xor_si128(fold(x3, k1k2), load(buf + 32));
+        x4 = _mm_xor_si128(fold(x4, k1k2), load(buf + 48));
+    }
+    x1 = _mm_xor_si128(fold(x1, k3k4), x2);
+    x1 = _mm_xor_si128(fold(x1, k3k4), x3);
+    x1 = _mm_xor_si128(fold(x1, k3k4), x4);
+    for (; len >= 16; buf += 16, len -= 16) {
+        x1 = _mm_xor_si128(fold(x1, k3k4), load(buf));
+    }
+
+    // 128 bits to 64
+    x2 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x10), x2);
+    // 64 bits to 32
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00), x2);
+    // Barrett reduction
+    x2 = x1;
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x00);
+    crc = uint32_t(_mm_extract_epi32(_mm_xor_si128(x1, x2), 1));
+    return update_slicing_by_8(SLICES, crc, buf, len);
+}
+#undef BRASA_CLMUL
+
+/** Whether the CPU has PCLMULQDQ (and SSE 4.1), checked once at start-up. */
+const bool HAS_CLMUL = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}();
+#else
+uint32_t update_clmul(const uint32_t crc, const uint8_t* buf, const size_t len) noexcept {
+    return update_slicing_by_8(SLICES, crc, buf, len);
+}
+
+const bool HAS_CLMUL = false;
+#endif
+
+/** IEEE polynomial, bit-reflected. */
+constexpr uint32_t IEEE = Crc32IsoHdlc::reflect(0x04c1'1db7);
+
+/**
+ * Returns the product of @p a and @p b modulo @p poly, all bit-reflected
+ * polynomials over GF(2); @p a must not be zero.
+ */
+constexpr uint32_t multiply(const uint32_t poly, const uint32_t a, uint32_t b) noexcept {
+    uint32_t product = 0;
+    for (uint32_t m = uint32_t(1) << 31;; m >>= 1) {
+        if ((a & m) != 0) {
+            product ^= b;
+            if ((a & (m - 1)) == 0) {
+                return product;
+            }
+        }
+        b = (b >> 1) ^ (poly & (0U - (b & 1)));
+    }
+}
+
+/** Powers `x^(2^k)`, enough to append up to 2^64 - 1 bytes (2^67 bits). */
+using Powers = std::array<uint32_t, 67>;
+
+/** Returns the powers `x^(2^k)` modulo @p poly. */
+constexpr Powers make_powers(const uint32_t poly) noexcept {
+    Powers powers{};
+    powers[0] = uint32_t(1) << 30; // x^1
+    for (size_t k = 1; k < powers.size(); ++k) {
+        powers[k] = multiply(poly, powers[k - 1], powers[k - 1]);
+    }
+    return powers;
+}
+
+constexpr auto IEEE_POWERS = make_powers(IEEE);
+
+/**
+ * Returns `x^(8 n)` modulo @p poly, whose powers are @p powers: the factor
+ * that appends @p n zero bytes to a CRC, in O(log n) multiplications.
+ */
+constexpr uint32_t x_to_the_8n(const uint32_t poly, const Powers& powers, uint64_t n) noexcept {
+    uint32_t result = uint32_t(1) << 31; // x^0
+    for (size_t k = 3; n != 0; n >>= 1, ++k) {
+        if ((n & 1) != 0) {
+            result = multiply(poly, powers[k], result);
+        }
+    }
+    return result;
+}
+
+/** Below this size the set-up of the carry-less multiplication does not pay off. */
+constexpr size_t CLMUL_THRESHOLD = 128;
+
+/**
+ * Tables that append @p LEN zero bytes to a (non-inverted) CRC-32C, one per
+ * byte of the CRC, to combine streams computed in parallel: the CRC of `A || B`
+ * is `shift(A)` XOR the CRC of @p B started from zero.
+ */
+template <size_t LEN>
+constexpr std::array<Table, 4> make_zeros() {
+    static_assert(LEN % sizeof(uint64_t) == 0);
+    // the shift is linear, so it is enough to shift each of the 32 bits
+    std::array<uint32_t, 32> bits{};
+    for (size_t bit = 0; bit < bits.size(); ++bit) {
+        auto crc = uint32_t(1) << bit;
+        for (size_t i = 0; i < LEN / sizeof(uint64_t); ++i) {
+            crc = update(C_SLICES, crc, uint64_t(0));
+        }
+        bits[bit] = crc;
+    }
+    std::array<Table, 4> zeros{};
+    for (size_t k = 0; k < zeros.size(); ++k) {
+        for (size_t b = 0; b < 256; ++b) {
+            for (size_t bit = 0; bit < 8; ++bit) {
+                if ((b >> bit) & 1) {
+                    zeros[k][b] ^= bits[8 * k + bit];
+                }
+            }
+        }
+    }
+    return zeros;
+}
+
+/** Appends the zero bytes of @p zeros to @p crc. */
+inline uint32_t shift(const std::array<Table, 4>& zeros, const uint32_t crc) noexcept {
+    return zeros[0][crc & 0xff] ^ zeros[1][(crc >> 8) & 0xff] ^ zeros[2][(crc >> 16) & 0xff]
+           ^ zeros[3][crc >> 24];
+}
+
+/** Block sizes of the 3-way interleaved CRC-32C. */
+constexpr size_t LONG = 8192;
+constexpr size_t SHORT = 256;
+constexpr auto LONG_ZEROS = make_zeros<LONG>();
+constexpr auto SHORT_ZEROS = make_zeros<SHORT>();
+
+#if defined(__x86_64__)
+#define BRASA_SSE42 [[gnu::target("sse4.2")]]
+
+BRASA_SSE42 inline uint64_t load64(const uint8_t* buf) noexcept {
+    uint64_t word;
+    std::memcpy(&word, buf, sizeof(word));
+    return word;
+}
+
+/**
+ * Folds blocks of 3 x @p BLOCK bytes of @p buf into @p crc, as three
+ * independent streams, while at least one such block is left.
+ */
+template <size_t BLOCK>
+BRASA_SSE42 inline uint64_t update_3way(
+      uint64_t crc,
+      const uint8_t*& buf,
+      size_t& len,
+      const std::array<Table, 4>& zeros) noexcept {
+    for (; len >= 3 * BLOCK; buf += 3 * BLOCK, len -= 3 * BLOCK) {
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        for (size_t i = 0; i < BLOCK; i += sizeof(uint64_t)) {
+            crc = _mm_crc32_u64(crc, load64(buf + i));
+            crc1 = _mm_crc32_u64(crc1, load64(buf + BLOCK + i));
+            crc2 = _mm_crc32_u64(crc2, load64(buf + 2 * BLOCK + i));
+        }
+        crc = shift(zeros, uint32_t(crc)) ^ crc1;
+        crc = shift(zeros, uint32_t(crc)) ^ crc2;
+    }
+    return crc;
+}
+
+/**
+ * Folds @p buf into the (non-inverted) CRC-32C @p crc with the SSE 4.2 `crc32`
+ * instruction. The instruction has a latency of 3 cycles but a throughput of
+ * one per cycle, so long buffers are cut into three blocks whose CRCs are
+ * computed in parallel and combined with `shift()`; as in "Fast CRC Computation
+ * for iSCSI Polynomial Using CRC32 Instruction" (Intel, 2011).
+ */
+BRASA_SSE42 uint32_t update_sse42(const uint32_t crc, const uint8_t* buf, size_t len) noexcept {
+    uint64_t crc64 = crc;
+    crc64 = update_3way<LONG>(crc64, buf, len, LONG_ZEROS);
+    crc64 = update_3way<SHORT>(crc64, buf, len, SHORT_ZEROS);
+    for (; len >= sizeof(uint64_t); buf += sizeof(uint64_t), len -= sizeof(uint64_t)) {
+        crc64 = _mm_crc32_u64(crc64, load64(buf));
+    }
+    auto crc32c = uint32_t(crc64);
+    for (; len != 0; --len) {
+        crc32c = _mm_crc32_u8(crc32c, *buf++);
+    }
+    return crc32c;
+}
+#undef BRASA_SSE42
+
+/** Whether the CPU has SSE 4.2, checked once at start-up. */
+const bool HAS_SSE42 = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2");
+}();
+#else
+uint32_t update_sse42(const uint32_t crc, const uint8_t* buf, const size_t len) noexcept {
+    return update_slicing_by_8(C_SLICES, crc, buf, len);
+}
+
+const bool HAS_SSE42 = false;
+#endif
+
+} // namespace
+
+uint32_t crc32(const uint8_t* buf, const size_t len) noexcept {
+    return crc32_update(0, buf, len);
+}
+
+uint32_t crc32_update(const uint32_t crc, const uint8_t* buf, const size_t len) noexcept {
+    // HAS_CLMUL is false until initialised, e.g. if called by another static initialiser
+    if (len >= CLMUL_THRESHOLD && HAS_CLMUL) {
+        return ~update_clmul(~crc, buf, len);
+    }
+    return ~update_slicing_by_8(SLICES, ~crc, buf, len);
+}
+
+uint32_t crc32_combine(const uint32_t crc_a, const uint32_t crc_b, const uint64_t len_b) noexcept {
+    return multiply(IEEE, x_to_the_8n(IEEE, IEEE_POWERS, len_b), crc_a) ^ crc_b;
+}
+
+uint32_t crc32_word(const uint64_t value) noexcept {
+    return ~update(SLICES, 0xffff'ffff, value);
+}
+
+uint32_t crc32_bytewise(const uint8_t* buf, const size_t len) noexcept {
+    return ~update_bytewise(SLICES, 0xffff'ffff, buf, len);
+}
+
+uint32_t crc32_slicing_by_8(const uint8_t* buf, const size_t len) noexcept {
+    return ~update_slicing_by_8(SLICES, 0xffff'ffff, buf, len);
+}
+
+uint32_t crc32_clmul(const uint8_t* buf, const size_t len) noexcept {
+    return ~update_clmul(0xffff'ffff, buf, len);
+}
+
+bool has_crc32_clmul() noexcept {
+    return HAS_CLMUL;
+}
+
+uint32_t crc32c(const uint8_t* buf, const size_t len) noexcept {
+    // HAS_SSE42 is false until initialised, e.g. if called by another static initialiser
+    if (HAS_SSE42) {
+        return crc32c_sse42(buf, len);
+    }
+    return crc32c_slicing_by_8(buf, len);
+}
+
+uint32_t crc32c_word(const uint64_t value) noexcept {
+    return ~update(C_SLICES, 0xffff'ffff, value);
+}
+
+uint32_t crc32c_slicing_by_8(const uint8_t* buf, const size_t len) noexcept {
+    return ~update_slicing_by_8(C_SLICES, 0xffff'ffff, buf, len);
+}
+
+uint32_t crc32c_sse42(const uint8_t* buf, const size_t len) noexcept {
+    return ~update_sse42(0xffff'ffff, buf, len);
+}
+
+bool has_crc32c_sse42() noexcept {
+    return HAS_SSE42;
 }
+} // namespace brasa::buffer::detail
@@ -1,15 +1,129 @@
 #pragma once
 
 /**
- * CRC-32 checksum utilities for the brasa buffer implementation.
+ * CRC checksum utilities for the brasa buffer implementation: `crc32` with the
+ * IEEE polynomial and `crc32c` with the Castagnoli one, optimised for the CPU,
+ * and the table-driven `Crc` for any CRC of up to 64 bits.
  * @see https://rosettacode.org/wiki/CRC-32
  */
 
+#include <array>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <type_traits>
 
 namespace brasa::buffer::detail {
 
+/**
+ * Table-driven CRC, one lookup per byte, described by the parameters of the
+ * "Catalogue of parametrised CRC algorithms"
+ * (https://reveng.sourceforge.io/crc-catalogue/). Everything is `constexpr`,
+ * including the table, so checksums of constants cost nothing at run time.
+ * Used as an accumulator:
+ * @code
+ * const auto crc = Crc16Arc().update(header).update(payload).value();
+ * @endcode
+ *
+ * @tparam TYPE_     Unsigned integer type whose width is the width of the CRC.
+ * @tparam POLY_     Generator polynomial, most significant bit first and
+ *                   without its leading term.
+ * @tparam REFLECT_  @c true if the bytes are fed least significant bit first
+ *                   and the result is reflected (refin = refout).
+ * @tparam INIT_     Initial value of the register.
+ * @tparam XOR_OUT_  Value XOR-ed into the register to give the checksum.
+ */
+template <std::unsigned_integral TYPE_, TYPE_ POLY_, bool REFLECT_, TYPE_ INIT_, TYPE_ XOR_OUT_>
+class Crc final {
+public:
+    using TYPE = TYPE_;
+
+    /** Number of bits of the CRC. */
+    constexpr static std::size_t WIDTH = 8 * sizeof(TYPE_);
+
+    /** Appends @p data to the checksummed data. */
+    constexpr Crc& update(const std::span<const uint8_t> data) noexcept {
+        for (const auto byte : data) {
+            register_ = step(register_, byte);
+        }
+        return *this;
+    }
+
+    /** Returns the checksum of the data appended so far. */
+    constexpr TYPE_ value() const noexcept { return TYPE_(register_ ^ XOR_OUT_); }
+
+    /** Returns the checksum of @p data. */
+    constexpr static TYPE_ checksum(const std::span<const uint8_t> data) noexcept {
+        return Crc().update(data).value();
+    }
+
+    /** Returns the checksum of the 8 bytes of @p value, in little-endian order. */
+    constexpr static TYPE_ checksum(const uint64_t value) noexcept {
+        Crc crc;
+        for (std::size_t i = 0; i < sizeof(value); ++i) {
+            crc.register_ = step(crc.register_, uint8_t(value >> (8 * i)));
+        }
+        return crc.value();
+    }
+
+    /** Returns @p value with its `WIDTH` bits in reverse order. */
+    constexpr static TYPE_ reflect(TYPE_ value) noexcept {
+        TYPE_ reflected = 0;
+        for (std::size_t bit = 0; bit < WIDTH; ++bit, value >>= 1) {
+            reflected = TYPE_((reflected << 1) | (value & 1));
+        }
+        return reflected;
+    }
+
+    /** Register after each byte value, starting from zero. */
+    constexpr static std::array<TYPE_, 256> TABLE = [] {
+        std::array<TYPE_, 256> table{};
+        for (std::size_t byte = 0; byte < table.size(); ++byte) {
+            if constexpr (REFLECT_) {
+                auto crc = TYPE_(byte);
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = TYPE_((crc >> 1) ^ ((crc & 1) != 0 ? reflect(POLY_) : 0));
+                }
+                table[byte] = crc;
+            } else {
+                auto crc = TYPE_(TYPE_(byte) << (WIDTH - 8));
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = TYPE_((crc << 1) ^ ((crc >> (WIDTH - 1)) != 0 ? POLY_ : 0));
+                }
+                table[byte] = crc;
+            }
+        }
+        return table;
+    }();
+
+private:
+    TYPE_ register_ = INIT_;
+
+    /** Folds one @p byte into the register @p crc. */
+    constexpr static TYPE_ step(const TYPE_ crc, const uint8_t byte) noexcept {
+        if constexpr (WIDTH == 8) {
+            return TABLE[crc ^ byte];
+        } else if constexpr (REFLECT_) {
+            return TYPE_(TABLE[(crc ^ byte) & 0xff] ^ (crc >> 8));
+        } else {
+            return TYPE_(TABLE[((crc >> (WIDTH - 8)) ^ byte) & 0xff] ^ (crc << 8));
+        }
+    }
+};
+
+/** @name Common CRCs, named as in the catalogue. @{ */
+using Crc16Arc = Crc<uint16_t, 0x8005, true, 0, 0>;
+using Crc16IbmSdlc = Crc<uint16_t, 0x1021, true, 0xffff, 0xffff>;
+using Crc16Ccitt = Crc<uint16_t, 0x1021, false, 0xffff, 0>;
+/** CRC-32 of `crc32()`, which is faster on buffers. */
+using Crc32IsoHdlc = Crc<uint32_t, 0x04c1'1db7, true, 0xffff'ffff, 0xffff'ffff>;
+/** CRC-32C of `crc32c()`, which is faster on buffers. */
+using Crc32Iscsi = Crc<uint32_t, 0x1edc'6f41, true, 0xffff'ffff, 0xffff'ffff>;
+using Crc64Xz = Crc<uint64_t, 0x42f0'e1eb'a9ea'3693, true, ~uint64_t(0), ~uint64_t(0)>;
+using Crc64Ecma182 = Crc<uint64_t, 0x42f0'e1eb'a9ea'3693, false, 0, 0>;
+/** @} */
+
 /**
  * Computes the CRC-32 checksum of a byte buffer.
  * @param buf Pointer to the first byte of the input data.
@@ -18,12 +132,152 @@ namespace brasa::buffer::detail {
  */
 uint32_t crc32(const uint8_t* buf, size_t len) noexcept;
 
+/** Run-time implementation of `crc32(uint64_t)`. */
+uint32_t crc32_word(uint64_t value) noexcept;
+
 /**
  * Computes the CRC-32 checksum of a 64-bit integer value.
- * The value is processed byte-by-byte in little-endian order.
+ * The value is processed byte-by-byte in little-endian order. It is a constant
+ * expression for a constant @p value, e.g. for the key of a buffer:
+ * `constexpr auto KEY_CRC = crc32(KEY);`.
  * @param value The 64-bit integer whose checksum is computed.
  * @return CRC-32 checksum of the value.
  */
-uint32_t crc32(uint64_t value) noexcept;
+constexpr uint32_t crc32(const uint64_t value) noexcept {
+    if (std::is_constant_evaluated()) {
+        return Crc32IsoHdlc::checksum(value);
+    }
+    return crc32_word(value);
+}
+
+/**
+ * Continues the CRC-32 checksum @p crc of some data with @p len more bytes, so
+ * that `crc32_update(crc32(a, m), b, n)` is the checksum of `a` followed by
+ * `b`; `crc32_update(0, buf, len)` is `crc32(buf, len)`.
+ * @param crc Checksum of the data before @p buf.
+ * @param buf Pointer to the first byte of the next data.
+ * @param len Number of bytes to process.
+ * @return CRC-32 checksum of the data followed by the buffer contents.
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t* buf, size_t len) noexcept;
+
+/**
+ * Returns the CRC-32 checksum of a block `A` followed by a block `B` from the
+ * checksums of each, e.g. to checksum the parts of a large buffer in parallel.
+ * Takes O(log @p len_b) carry-less multiplications in software.
+ * @param crc_a Checksum of `A`.
+ * @param crc_b Checksum of `B`.
+ * @param len_b Length of `B` in bytes.
+ * @return CRC-32 checksum of `A` followed by `B`.
+ */
+uint32_t crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b) noexcept;
+
+/**
+ * Accumulates the CRC-32 checksum of data that arrives in chunks:
+ * @code
+ * Crc32 crc;
+ * crc.update(header).update(payload);
+ * send(crc.value());
+ * @endcode
+ */
+class Crc32 final {
+public:
+    /** Appends @p data to the checksummed data. */
+    Crc32& update(const std::span<const uint8_t> data) noexcept {
+        value_ = crc32_update(value_, data.data(), data.size());
+        return *this;
+    }
+
+    /** Returns the CRC-32 checksum of the data appended so far. */
+    uint32_t value() const noexcept { return value_; }
+
+private:
+    uint32_t value_ = 0;
+};
+
+/**
+ * @name CRC-32 implementations
+ * The implementations that `crc32(const uint8_t*, size_t)` chooses from, all
+ * giving the same result; exposed to test and benchmark them. It uses
+ * carry-less multiplication for large buffers when the CPU supports it and
+ * slicing-by-8 otherwise.
+ * @{
+ */
+/** One table lookup per byte (the reference implementation). */
+uint32_t crc32_bytewise(const uint8_t* buf, size_t len) noexcept;
+
+/** Eight independent table lookups per 8 bytes. */
+uint32_t crc32_slicing_by_8(const uint8_t* buf, size_t len) noexcept;
+
+/**
+ * Folding with carry-less multiplications (x86-64 `PCLMULQDQ`), 64 bytes at a
+ * time. Must only be called if `has_crc32_clmul()`; falls back to
+ * slicing-by-8 on other architectures.
+ */
+uint32_t crc32_clmul(const uint8_t* buf, size_t len) noexcept;
+
+/** Returns @c true if the CPU supports `crc32_clmul()`. */
+bool has_crc32_clmul() noexcept;
+/** @} */
+
+/**
+ * Computes the CRC-32C (Castagnoli polynomial, as in iSCSI, ext4 or SCTP)
+ * checksum of a byte buffer.
+ * @param buf Pointer to the first byte of the input data.
+ * @param len Number of bytes to process.
+ * @return CRC-32C checksum of the buffer contents.
+ */
+uint32_t crc32c(const uint8_t* buf, size_t len) noexcept;
+
+/** Run-time implementation of `crc32c(uint64_t)`. */
+uint32_t crc32c_word(uint64_t value) noexcept;
+
+/**
+ * Computes the CRC-32C checksum of a 64-bit integer value, processed in
+ * little-endian order; a constant expression for a constant @p value.
+ * @param value The 64-bit integer whose checksum is computed.
+ * @return CRC-32C checksum of the value.
+ */
+constexpr uint32_t crc32c(const uint64_t value) noexcept {
+    if (std::is_constant_evaluated()) {
+        return Crc32Iscsi::checksum(value);
+    }
+    return crc32c_word(value);
+}
+
+/**
+ * @name CRC-32C implementations
+ * The implementations that `crc32c(const uint8_t*, size_t)` chooses from: the
+ * SSE 4.2 instruction when the CPU supports it and slicing-by-8 otherwise.
+ * @{
+ */
+/** Eight independent table lookups per 8 bytes. */
+uint32_t crc32c_slicing_by_8(const uint8_t* buf, size_t len) noexcept;
+
+/**
+ * The x86-64 SSE 4.2 `crc32` instruction, on three interleaved streams for
+ * buffers of 768 bytes or more. Must only be called if `has_crc32c_sse42()`;
+ * falls back to slicing-by-8 on other architectures.
+ */
+uint32_t crc32c_sse42(const uint8_t* buf, size_t len) noexcept;
+
+/** Returns @c true if the CPU supports `crc32c_sse42()`. */
+bool has_crc32c_sse42() noexcept;
+/** @} */
 
 } // namespace brasa::buffer::detail
+
+namespace brasa::buffer {
+
+/**
+ * Key of a buffer known at compile time, e.g. `Key<0x1234>{}`, that can be
+ * given to the buffer views instead of a `uint64_t` so that the CRC-32 stored
+ * next to the key is computed by the compiler rather than on every attach.
+ * @tparam VALUE_ The key.
+ */
+template <uint64_t VALUE_>
+struct Key final {
+    static constexpr uint64_t value = VALUE_;              ///< The key.
+    static constexpr uint32_t crc = detail::crc32(VALUE_); ///< CRC-32 of the key.
+};
+} // namespace brasa::buffer
@@ -13,9 +13,15 @@
  */
 
 #include <brasa/buffer/CRC.h>
+#include <brasa/buffer/Futex.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -24,29 +30,107 @@ namespace brasa::buffer::detail {
 /**
  * Cursor that tracks the current position inside a circular buffer. Both the
  * write head and the read head are represented as a @p Head.
+ *
+ * The pair is aligned to 8 bytes so that it can be loaded and stored as one
+ * 64-bit word through `std::atomic_ref`, which guarantees that a reader never
+ * observes an `index` from one update combined with the `lap` of another.
  * @attention `lap` wraps around after 2^32 laps, but this should not be an
  * issue in practice since each lap corresponds to `N_` writes.
  */
-struct Head final {
+struct alignas(sizeof(uint64_t)) Head final {
     uint32_t index; ///< Slot index in the data array (0...N-1).
     uint32_t lap;   ///< Number of times the index has wrapped around.
 };
 static_assert(std::is_trivial_v<Head>, "Head must remain a POD");
+static_assert(sizeof(Head) == sizeof(uint64_t), "Head must fit in a single 64-bit word");
+static_assert(std::atomic_ref<Head>::is_always_lock_free, "Head must be lock-free");
+static_assert(alignof(Head) >= std::atomic_ref<Head>::required_alignment);
+
+/** Atomically loads @p head as a single 64-bit word. */
+inline Head load_head(Head& head, const std::memory_order order) noexcept {
+    return std::atomic_ref<Head>(head).load(order);
+}
+
+/** Atomically stores @p value into @p head as a single 64-bit word. */
+inline void store_head(Head& head, const Head value, const std::memory_order order) noexcept {
+    std::atomic_ref<Head>(head).store(value, order);
+}
+
+/**
+ * Cumulative counters kept by the reader in the buffer, so that a third party
+ * can watch them (see `CircularMonitor`) without disturbing the writer. The
+ * number of elements written is not kept: it is derived from the write head.
+ * Only the reader updates them, with relaxed atomic stores.
+ */
+struct ReaderStats final {
+    uint64_t read;    ///< Number of elements read.
+    uint64_t dropped; ///< Number of elements overwritten before being read.
+    uint64_t max_lag; ///< Largest number of unread elements observed by a read.
+};
+static_assert(std::is_trivial_v<ReaderStats>, "ReaderStats must remain a POD");
 
 /**
  * Raw memory layout of the circular buffer.
  * This struct is mapped directly onto the caller-supplied byte buffer, so its
- * layout must remain stable (no virtual functions, no padding surprises).
+ * layout must remain stable (no virtual functions, no padding surprises). The
+ * layout is not versioned: every process sharing a buffer must be built with
+ * the same version of this header.
  * @tparam TYPE_ Element type stored in the buffer.
  * @tparam N_    Capacity in number of elements.
  */
 template <typename TYPE_, uint32_t N_>
 struct BufferData final {
-    TYPE_ data[N_];  ///< Ring of stored elements.
-    Head write_head; ///< Position and lap of the next write slot.
-    Head read_head;  ///< Position and lap of the next read slot.
-    uint64_t key;    ///< Unique identifier used to verify buffer ownership.
-    uint32_t crc;    ///< CRC-32 of @p key, used to detect uninitialized memory.
+    TYPE_ data[N_];           ///< Ring of stored elements.
+    Head write_head;          ///< Position and lap of the next write slot.
+    Head claim_head;          ///< End of the slots being written (@p write_head when idle).
+    Head read_head;           ///< Position and lap of the next read slot.
+    uint64_t key;             ///< Unique identifier used to verify buffer ownership.
+    uint32_t crc;             ///< CRC-32 of @p key, used to detect uninitialized memory.
+    uint32_t blocking;        ///< Non-zero if the writer wakes the blocked readers.
+    uint32_t waiters;         ///< Number of readers blocked waiting for the write head.
+    ReaderStats reader_stats; ///< Counters updated by the reader.
+};
+
+/**
+ * Cache line size assumed when separating data touched by different cores.
+ * @note `std::hardware_destructive_interference_size` is not used because its
+ * value depends on compiler version and tuning flags, and the layout of a
+ * buffer shared between binaries must not.
+ */
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * Alternative memory layout of the circular buffer that avoids false sharing
+ * between the writer and the reader.
+ *
+ * In @p BufferData both heads share a cache line, so every write invalidates
+ * the line the reader polls and every read invalidates the writer's line. Here
+ * the write head, the claim head, the read head and the read-only @p key /
+ * @p crc each live on their own cache line. The reader also keeps on its line
+ * a cached copy of the write head and only reloads the write head when the
+ * cached copy says that the buffer is empty. It still loads the claim head
+ * once per read to detect torn elements: that does not take the write head's
+ * line from the writer, but the claim head's line moves to the reader's core
+ * whenever the writer has written since the previous read. The writer never
+ * consults the read head (writes always succeed), so it needs no cached copy
+ * of it. The count of blocked readers, which the writer checks on every write
+ * but readers rarely change, shares the line of @p key / @p crc.
+ *
+ * @tparam TYPE_ Element type stored in the buffer.
+ * @tparam N_    Capacity in number of elements.
+ */
+template <typename TYPE_, uint32_t N_>
+struct BufferDataPadded final {
+    alignas(CACHE_LINE_SIZE) TYPE_ data[N_];     ///< Ring of stored elements.
+    alignas(CACHE_LINE_SIZE) Head write_head;    ///< Position and lap of the next write slot.
+    alignas(CACHE_LINE_SIZE) Head claim_head;    ///< End of the slots being written.
+    alignas(CACHE_LINE_SIZE) Head read_head;     ///< Position and lap of the next read slot.
+    Head write_head_cache;                       ///< Reader's last observed @p write_head.
+    ReaderStats reader_stats;                    ///< Counters updated by the reader.
+    alignas(CACHE_LINE_SIZE) uint64_t key;       ///< Unique identifier of the buffer.
+    uint32_t crc;                                ///< CRC-32 of @p key.
+    uint32_t blocking;                           ///< Non-zero if the writer wakes blocked readers.
+    uint32_t waiters;                            ///< Readers blocked waiting for the write head.
 };
 
 /**
@@ -55,21 +139,48 @@ struct BufferData final {
  * @p Writer and @p Reader subclasses.
  *
  * **Thread / process safety:** concurrent access by one writer and one reader
- * is supported provided accesses to individual slots are atomic at the hardware
- * level. No explicit synchronisation primitives are used.
+ * is supported. The heads are published with release semantics and consumed
+ * with acquire semantics, so a reader that observes a write head also observes
+ * the contents of every slot written before it, even on weakly-ordered CPUs.
+ * The synchronisation is lock-free and works across processes sharing the
+ * mapping, since `BufferData` itself holds no `std::atomic` members.
+ * If @p BLOCKING_, readers may block while the buffer is empty
+ * (`do_read_wait()`), and the writer pays a full fence on every write and
+ * commit, blocked reader or not, to check whether it must wake them (a locked
+ * instruction on x86). Otherwise the writer only makes a release store.
  *
  * **Overrun behaviour:** if the writer is exactly one lap ahead and its index
  * has already passed the reader's index, the reader skips forward. If the
  * writer is more than one lap ahead the reader catches up to within one lap of
  * the writer, skipping all intermediate data.
  *
- * @tparam TYPE_ Element type. Must be copy- and nothrow-move constructible/assignable.
- * @tparam N_    Capacity (number of elements). Must be at least 2.
+ * **Torn elements:** the writer may also lap the reader while it copies a
+ * slot. Before writing, the writer announces the slots it is about to
+ * overwrite in @p claim_head, seqlock style; after copying, the reader checks
+ * that claim head and drops (and counts as dropped) the elements whose slot
+ * was being rewritten, so it never returns a half-written element.
+ *
+ * @tparam TYPE_   Element type. Must be copy- and nothrow-move constructible/assignable.
+ * @tparam N_      Capacity (number of elements). Must be at least 2.
+ * @tparam LAYOUT_ Memory layout of the buffer: @p BufferData (compact, the
+ *                 default) or @p BufferDataPadded (one cache line per head).
+ * @tparam BLOCKING_ Whether readers may block waiting for the writer. It is
+ *                   stored in the buffer like the key, so a view with another
+ *                   value resets the buffer instead of attaching to it.
  */
-template <typename TYPE_, uint32_t N_>
+template <
+      typename TYPE_,
+      uint32_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = BufferData,
+      bool BLOCKING_ = false>
 class Circular {
 protected: // to allow testing and prevent use outside of the classes
-    using BufferDataT = BufferData<TYPE_, N_>;
+    using BufferDataT = LAYOUT_<TYPE_, N_>;
+
+    /** Whether the layout keeps a reader-side copy of the write head. */
+    constexpr static bool CACHES_WRITE_HEAD = requires(BufferDataT& buffer_data) {
+        buffer_data.write_head_cache;
+    };
 
 public:
     static_assert(N_ >= 2);
@@ -77,8 +188,8 @@ public:
     static_assert(std::is_nothrow_move_constructible_v<TYPE_>);
     static_assert(std::is_copy_assignable_v<TYPE_>);
     static_assert(std::is_copy_constructible_v<TYPE_>);
-    static_assert(std::is_standard_layout_v<BufferData<TYPE_, N_>>);
-    static_assert(std::is_trivially_copyable_v<BufferData<TYPE_, N_>>);
+    static_assert(std::is_standard_layout_v<BufferDataT>);
+    static_assert(std::is_trivially_copyable_v<BufferDataT>);
 
     using TYPE = TYPE_;
     /** Buffer capacity (number of elements). */
@@ -119,14 +230,14 @@ protected:
      * @param key    Unique identifier for this buffer; used to detect whether
      *               the buffer has already been initialised.
      */
-    Circular(uint8_t* buffer, const uint64_t key)
-          : buffer_(aligned_in_buffer(buffer)),
-            key_(key),
-            crc_(crc32(key)) {
-        if (not is_initialized()) {
-            initialize();
-        }
-    }
+    Circular(uint8_t* buffer, const uint64_t key) : Circular(buffer, key, crc32(key)) {}
+
+    /**
+     * Same as `Circular(uint8_t*, uint64_t)` for a key known at compile time,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    Circular(uint8_t* buffer, const Key<KEY_> key) : Circular(buffer, key.value, key.crc) {}
 
     ~Circular() noexcept = default;
 
@@ -137,8 +248,68 @@ protected:
      */
     void do_write(TYPE value) noexcept {
         auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
-        buffer_data->data[buffer_data->write_head.index] = std::move(value);
-        advance(buffer_data->write_head);
+        // only this writer changes the write head, so it can be read relaxed
+        auto write_head = load_head(buffer_data->write_head, std::memory_order_relaxed);
+        announce(*buffer_data, write_head, 1);
+        buffer_data->data[write_head.index] = std::move(value);
+        advance(write_head);
+        publish(*buffer_data, write_head);
+    }
+
+    /**
+     * Writes all @p values into consecutive slots and advances the write head
+     * once for the whole batch. The elements are copied with at most two
+     * `memcpy`s (before and after the wrap point). If the batch is larger than
+     * the buffer only its last `N_` elements are kept, as if they had been
+     * written one by one.
+     * @param values Elements to store, in order.
+     */
+    void do_write(std::span<const TYPE> values) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto write_head = load_head(buffer_data->write_head, std::memory_order_relaxed);
+        const auto skipped = values.size() > N_ ? values.size() - N_ : 0;
+        advance(write_head, skipped);
+        values = values.subspan(skipped);
+
+        const auto count = values.size();
+        announce(*buffer_data, write_head, count);
+        const auto first = std::min<std::size_t>(count, N_ - write_head.index);
+        std::memcpy(&buffer_data->data[write_head.index], values.data(), first * sizeof(TYPE));
+        std::memcpy(&buffer_data->data[0], values.data() + first, (count - first) * sizeof(TYPE));
+        advance(write_head, count);
+        publish(*buffer_data, write_head);
+    }
+
+    /**
+     * Returns up to @p count consecutive slots starting at the write head, so
+     * that values can be built in place. The run stops at the end of the data
+     * array, so fewer slots than requested may be returned. Nothing is visible
+     * to the reader until `do_commit()` is called.
+     * @param count Number of slots wanted.
+     * @return the claimed slots; never empty when @p count > 0.
+     */
+    std::span<TYPE> do_claim(const std::size_t count) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_relaxed);
+        const auto size = std::min<std::size_t>(count, N_ - write_head.index);
+        announce(*buffer_data, write_head, size);
+        return std::span<TYPE>(&buffer_data->data[write_head.index], size);
+    }
+
+    /**
+     * Publishes the first @p count slots returned by `do_claim()` by advancing
+     * the write head once. The claim on the slots that are not published is
+     * withdrawn, so that a lagging reader does not drop the elements they
+     * still hold; a lagging reader may read those elements, so they should be left
+     * untouched.
+     * @param count Number of slots to publish; must not exceed the claimed size.
+     */
+    void do_commit(const std::size_t count) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto write_head = load_head(buffer_data->write_head, std::memory_order_relaxed);
+        advance(write_head, count);
+        store_head(buffer_data->claim_head, write_head, std::memory_order_relaxed);
+        publish(*buffer_data, write_head);
     }
 
     /**
@@ -149,37 +320,272 @@ protected:
      * @return @c true if an element was read; @c false if the buffer is empty.
      */
     bool do_read(TYPE& value) noexcept {
+        std::size_t dropped;
+        return do_read(value, dropped);
+    }
+
+    /**
+     * Same as `do_read(TYPE&)`, also reporting the overwritten elements
+     * skipped by this read. Updates the reader statistics in the buffer.
+     * @param[out] value   Receives the element on success.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return @c true if an element was read; @c false if the buffer is empty.
+     */
+    bool do_read(TYPE& value, std::size_t& dropped) noexcept {
         auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
-        const auto write_head = buffer_data->write_head;
-        auto read_head = buffer_data->read_head;
+        auto read_head = load_head(buffer_data->read_head, std::memory_order_relaxed);
+        const auto write_head = load_write_head(*buffer_data, read_head, 1);
+        const auto lag = distance(read_head, write_head);
 
-        if (read_head.index == write_head.index && read_head.lap == write_head.lap) {
+        if (not read_at(*buffer_data, read_head, write_head, value, dropped)) {
             return false;
         }
-        switch (write_head.lap - read_head.lap) {
-            case 0: // same lap
-                break;
-            case 1: // one lap ahead
-                if (write_head.index > read_head.index) {
-                    read_head.index = write_head.index;
-                }
-                break;
-            default: // more than one lap ahead
-                read_head.index = write_head.index;
-                read_head.lap = write_head.lap - 1;
+        store_head(buffer_data->read_head, read_head, std::memory_order_release);
+        record_read(*buffer_data, 1, dropped, lag);
+        return true;
+    }
+
+    /**
+     * Reads up to `values.size()` available elements into @p values and
+     * advances the read head once for the whole batch. The elements are copied
+     * with at most two `memcpy`s. Overruns are handled as in the single
+     * element overload.
+     * @param[out] values Receives the elements read, starting at its first position.
+     * @return the number of elements read (0 if the buffer is empty).
+     */
+    std::size_t do_read(std::span<TYPE> values) noexcept {
+        std::size_t dropped;
+        return do_read(values, dropped);
+    }
+
+    /**
+     * Same as `do_read(std::span<TYPE>)`, also reporting the overwritten
+     * elements skipped by this read. Updates the reader statistics.
+     * @param[out] values  Receives the elements read, starting at its first position.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return the number of elements read (0 if the buffer is empty).
+     */
+    std::size_t do_read(std::span<TYPE> values, std::size_t& dropped) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto read_head = load_head(buffer_data->read_head, std::memory_order_relaxed);
+        const auto write_head = load_write_head(*buffer_data, read_head, values.size());
+        const auto lag = distance(read_head, write_head);
+
+        const auto count = read_at(*buffer_data, read_head, write_head, values, dropped);
+        if (count != 0) {
+            store_head(buffer_data->read_head, read_head, std::memory_order_release);
+            record_read(*buffer_data, count, dropped, lag);
         }
-        value = std::move(buffer_data->data[read_head.index]);
-        advance(read_head);
-        buffer_data->read_head = read_head;
+        return count;
+    }
 
-        return true;
+    /**
+     * Same as `do_read(TYPE&)`, but reading from the private @p cursor instead
+     * of the shared read head, which is left untouched. This allows any number
+     * of readers, each with its own cursor, to consume the same buffer. The
+     * reader statistics in the buffer are not updated.
+     * @param[out] value  Receives the element on success.
+     * @param[in,out] cursor Position of the calling reader.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return @c true if an element was read; @c false if the buffer is empty.
+     */
+    bool do_read(TYPE& value, Head& cursor, std::size_t& dropped) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_acquire);
+        return read_at<false>(*buffer_data, cursor, write_head, value, dropped);
+    }
+
+    /**
+     * Same as `do_read(std::span<TYPE>)`, but reading from the private
+     * @p cursor instead of the shared read head.
+     * @param[out] values Receives the elements read, starting at its first position.
+     * @param[in,out] cursor Position of the calling reader.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return the number of elements read (0 if the buffer is empty).
+     */
+    std::size_t do_read(std::span<TYPE> values, Head& cursor, std::size_t& dropped) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_acquire);
+        return read_at<false>(*buffer_data, cursor, write_head, values, dropped);
+    }
+
+    /**
+     * Same as `do_read(TYPE&)`, but if the buffer is empty blocks until the
+     * writer publishes an element or @p timeout elapses. The reader parks on
+     * the write head with a shared futex, so it can be woken by a writer in
+     * another process.
+     * @param[out] value Receives the element on success.
+     * @param timeout Maximum time to block.
+     * @return @c true if an element was read; @c false on timeout or if a
+     *         non-blocking view has reset the buffer.
+     */
+    bool do_read_wait(TYPE& value, const std::chrono::nanoseconds timeout) noexcept {
+        return wait_for([&] { return do_read(value); }, timeout);
+    }
+
+    /**
+     * Same as `do_read_wait(TYPE&, std::chrono::nanoseconds)`, but reading
+     * from the private @p cursor as `do_read(TYPE&, Head&, std::size_t&)` does.
+     */
+    bool do_read_wait(
+          TYPE& value,
+          Head& cursor,
+          const std::chrono::nanoseconds timeout) noexcept {
+        std::size_t dropped;
+        return wait_for([&] { return do_read(value, cursor, dropped); }, timeout);
+    }
+
+    /** Returns the current write head, e.g. to start a private cursor. */
+    Head do_write_head() const noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        return load_head(buffer_data->write_head, std::memory_order_acquire);
+    }
+
+    /**
+     * Returns the run of consecutive readable slots starting at the read head,
+     * without copying them. The run stops at the end of the data array. If the
+     * writer has lapped the reader, the read head is first fast-forwarded as
+     * in `do_read()`. The slots stay in the buffer until `do_release()`.
+     * @return the readable slots; empty if the buffer is empty.
+     */
+    std::span<const TYPE> do_peek() noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto read_head = load_head(buffer_data->read_head, std::memory_order_relaxed);
+        const auto write_head = load_write_head(*buffer_data, read_head, 1);
+
+        if (is_empty(read_head, write_head)) {
+            return {};
+        }
+        const auto lag = distance(read_head, write_head);
+        const auto dropped = catch_up(read_head, write_head);
+        store_head(buffer_data->read_head, read_head, std::memory_order_relaxed);
+        record_read(*buffer_data, 0, dropped, lag);
+        const auto size = std::min<uint64_t>(distance(read_head, write_head), N_ - read_head.index);
+        return std::span<const TYPE>(&buffer_data->data[read_head.index], size);
+    }
+
+    /**
+     * Consumes the first @p count slots returned by `do_peek()` by advancing
+     * the read head once, and tells how many of them were intact. Since the
+     * slots are read in place, the writer may have lapped the reader while it
+     * was reading them; the torn ones are always the first ones of the run.
+     * @param count Number of slots consumed; must not exceed the peeked size.
+     * @return the number of slots, at the end of the run, that were not
+     *         overwritten before this call.
+     */
+    std::size_t do_release(const std::size_t count) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto read_head = load_head(buffer_data->read_head, std::memory_order_relaxed);
+        const auto torn = count_torn(*buffer_data, read_head, count);
+        advance(read_head, count);
+        store_head(buffer_data->read_head, read_head, std::memory_order_release);
+        record_read(*buffer_data, count - torn, torn, 0);
+        return count - torn;
     }
 
 private:
+    /** Constructs the view for @p key, whose CRC-32 is @p crc. */
+    Circular(uint8_t* buffer, const uint64_t key, const uint32_t crc)
+          : buffer_(aligned_in_buffer(buffer)),
+            key_(key),
+            crc_(crc) {
+        if (not is_initialized()) {
+            initialize();
+        }
+    }
+
     uint8_t* buffer_;
     const uint64_t key_;
     const uint32_t crc_;
 
+    /**
+     * Publishes @p write_head to the readers and, if @p BLOCKING_, wakes those
+     * blocked in `do_read_wait()`. The fence orders the head store before the
+     * load of @p waiters, pairing with the reader that registers itself before
+     * re-checking the head, so either the writer sees the reader or the reader
+     * sees the new head.
+     */
+    static void publish(BufferDataT& buffer_data, const Head& write_head) noexcept {
+        store_head(buffer_data.write_head, write_head, std::memory_order_release);
+        if constexpr (BLOCKING_) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto waiters = std::atomic_ref<uint32_t>(buffer_data.waiters);
+            if (waiters.load(std::memory_order_relaxed) != 0) {
+                futex_wake_all(buffer_data.write_head.index);
+            }
+        }
+    }
+
+    /**
+     * Announces in @p claim_head that the @p count slots from @p write_head
+     * are about to be overwritten. The fence orders the store before the
+     * writes to the slots, pairing with the fence in `count_torn()`, so that a
+     * reader that copied any byte of these writes also sees the claim.
+     */
+    static void announce(
+          BufferDataT& buffer_data,
+          Head write_head,
+          const std::size_t count) noexcept {
+        advance(write_head, count);
+        store_head(buffer_data.claim_head, write_head, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /**
+     * Returns how many of the @p count elements just copied from @p from may
+     * have been overwritten during the copy, i.e. whose slot had been claimed
+     * by the writer for the next lap. They are always the first ones.
+     */
+    static std::size_t count_torn(
+          BufferDataT& buffer_data,
+          const Head& from,
+          const std::size_t count) noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto claim_head = load_head(buffer_data.claim_head, std::memory_order_relaxed);
+        // the slot of the element at position p is rewritten by the write at p + N_
+        const auto ahead = distance(from, claim_head);
+        return ahead > N_ ? std::size_t(std::min<uint64_t>(ahead - N_, count)) : 0;
+    }
+
+    /**
+     * Calls @p read until it succeeds, blocking on the write head between
+     * attempts, or until @p timeout elapses or a non-blocking view resets the
+     * buffer.
+     */
+    template <typename READ>
+    bool wait_for(READ read, const std::chrono::nanoseconds timeout) noexcept {
+        static_assert(BLOCKING_, "only a blocking buffer wakes up the readers");
+        if (read()) {
+            return true;
+        }
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        std::atomic_ref<uint32_t> waiters(buffer_data->waiters);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool success = false;
+        for (;;) {
+            // the head is loaded before reading so that a write in between
+            // changes the futex word and the wait returns at once (unless
+            // exactly N_ writes bring the index back, which only delays the
+            // reader until the next write or the timeout)
+            const auto write_head = load_head(buffer_data->write_head, std::memory_order_seq_cst);
+            if (read()) {
+                success = true;
+                break;
+            }
+            const auto remaining = deadline - std::chrono::steady_clock::now();
+            // a non-blocking view that has reset the buffer would never wake this reader
+            const auto blocking = std::atomic_ref<uint32_t>(buffer_data->blocking);
+            if (remaining <= remaining.zero() || blocking.load(std::memory_order_relaxed) == 0) {
+                break;
+            }
+            futex_wait(buffer_data->write_head.index, write_head.index, remaining);
+        }
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return success;
+    }
+
     /** Returns @c true if @p head holds a valid slot index (< N_). */
     [[nodiscard]] bool is_valid(const Head& head) const noexcept { return head.index < N_; }
 
@@ -194,29 +600,240 @@ private:
     }
 
     /**
-     * Returns @c true if the buffer's key, CRC, and head positions are all
-     * consistent with this instance — i.e. the buffer was previously
-     * initialised by a @p Circular with the same @p key.
+     * Returns @c true if the buffer's key, CRC, blocking flag and head
+     * positions are all consistent with this instance — i.e. the buffer was
+     * previously initialised by a @p Circular with the same @p key and
+     * @p BLOCKING_.
      */
     [[nodiscard]] bool is_initialized() const noexcept {
-        const auto buffer_data = reinterpret_cast<const BufferDataT*>(buffer_);
-        return is_valid(buffer_data->read_head, buffer_data->write_head) && buffer_data->key == key_
-               && buffer_data->crc == crc_;
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto read_head = load_head(buffer_data->read_head, std::memory_order_acquire);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_acquire);
+        const auto claim_head = load_head(buffer_data->claim_head, std::memory_order_acquire);
+        // a writer that stopped in the middle of a write leaves its claim ahead
+        if (not is_valid(write_head, claim_head) || distance(write_head, claim_head) > N_) {
+            return false;
+        }
+        if constexpr (CACHES_WRITE_HEAD) {
+            const auto cache = load_head(buffer_data->write_head_cache, std::memory_order_relaxed);
+            if (not is_valid(read_head, cache) || not is_valid(cache, write_head)) {
+                return false;
+            }
+        }
+        return is_valid(read_head, write_head) && buffer_data->key == key_
+               && buffer_data->crc == crc_ && buffer_data->blocking == uint32_t(BLOCKING_);
     }
 
-    /** Resets the buffer to an empty state and stamps it with @p key_ and @p crc_. */
+    /**
+     * Resets the buffer to an empty state and stamps it with @p key_, @p crc_
+     * and @p BLOCKING_.
+     */
     void initialize() noexcept {
         auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
         constexpr Head zero = { 0, 0 };
 
-        buffer_data->read_head = zero;
-        buffer_data->write_head = zero;
+        store_head(buffer_data->read_head, zero, std::memory_order_relaxed);
+        store_head(buffer_data->write_head, zero, std::memory_order_relaxed);
+        store_head(buffer_data->claim_head, zero, std::memory_order_relaxed);
+        if constexpr (CACHES_WRITE_HEAD) {
+            store_head(buffer_data->write_head_cache, zero, std::memory_order_relaxed);
+        }
         buffer_data->key = key_;
         buffer_data->crc = crc_;
+        buffer_data->blocking = uint32_t(BLOCKING_);
+        buffer_data->waiters = 0;
+        buffer_data->reader_stats = {};
+    }
+
+    /** Returns @c true if there is nothing to read between @p read_head and @p write_head. */
+    static bool is_empty(const Head& read_head, const Head& write_head) noexcept {
+        return read_head.index == write_head.index && read_head.lap == write_head.lap;
+    }
+
+    /**
+     * Returns the number of elements from @p read_head up to @p write_head,
+     * which may exceed `N_` if the reader has been lapped.
+     */
+    static uint64_t distance(const Head& read_head, const Head& write_head) noexcept {
+        return uint64_t(uint32_t(write_head.lap - read_head.lap)) * N_ + write_head.index
+               - read_head.index;
+    }
+
+    /** Returns @c true if @p head is past @p from, allowing for the lap counter to wrap. */
+    static bool is_ahead(const Head& from, const Head& head) noexcept {
+        const auto laps = int32_t(head.lap - from.lap);
+        return laps > 0 || (laps == 0 && head.index > from.index);
+    }
+
+    /**
+     * Returns the write head as seen by the reader positioned at @p read_head
+     * that wants to read @p wanted elements. With a layout that caches the
+     * write head, the writer's cache line is only touched when the cached copy
+     * shows fewer than @p wanted elements left to read. A cached copy that is
+     * not ahead of the read head predates a catch-up and is never used.
+     */
+    static Head load_write_head(
+          BufferDataT& buffer_data,
+          const Head& read_head,
+          const std::size_t wanted) noexcept {
+        if constexpr (CACHES_WRITE_HEAD) {
+            const auto cache = load_head(buffer_data.write_head_cache, std::memory_order_relaxed);
+            if (is_ahead(read_head, cache)
+                && distance(read_head, cache) >= std::max<std::size_t>(wanted, 1)) {
+                return cache;
+            }
+        }
+        return reload_write_head(buffer_data);
+    }
+
+    /**
+     * Loads the write head from the writer's cache line and, with a layout
+     * that caches it and if @p OWNS_CACHE_, refreshes the reader's copy.
+     */
+    template <bool OWNS_CACHE_ = true>
+    static Head reload_write_head(BufferDataT& buffer_data) noexcept {
+        const auto write_head = load_head(buffer_data.write_head, std::memory_order_acquire);
+        if constexpr (CACHES_WRITE_HEAD && OWNS_CACHE_) {
+            store_head(buffer_data.write_head_cache, write_head, std::memory_order_relaxed);
+        }
+        return write_head;
+    }
+
+    /**
+     * Copies the element at @p read_head into @p value and advances
+     * @p read_head, after catching up with @p write_head if it has been lapped.
+     * An element overwritten while it was copied is skipped and the next one
+     * is read instead, against a reloaded write head. The slot is copied into
+     * a local first, so @p value is left unchanged when nothing is read.
+     * @tparam OWNS_CACHE_ Whether @p read_head is the shared read head, whose
+     *                     reader keeps the cached write head up to date.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return @c false if there is nothing to read.
+     */
+    template <bool OWNS_CACHE_ = true>
+    static bool read_at(
+          BufferDataT& buffer_data,
+          Head& read_head,
+          Head write_head,
+          TYPE& value,
+          std::size_t& dropped) noexcept {
+        dropped = 0;
+        while (not is_empty(read_head, write_head)) {
+            dropped += catch_up(read_head, write_head);
+            TYPE element = buffer_data.data[read_head.index];
+            const auto torn = count_torn(buffer_data, read_head, 1);
+            advance(read_head);
+            if (torn == 0) {
+                value = std::move(element);
+                return true;
+            }
+            ++dropped;
+            write_head = reload_write_head<OWNS_CACHE_>(buffer_data);
+        }
+        return false;
+    }
+
+    /**
+     * Copies up to `values.size()` elements starting at @p read_head into
+     * @p values and advances @p read_head past them, after catching up with
+     * @p write_head if it has been lapped. The elements overwritten while they
+     * were copied are dropped and the intact ones moved to the front of
+     * @p values. The positions of @p values past the elements read, all of
+     * them if nothing is read, are left unspecified.
+     * @tparam OWNS_CACHE_ As for the single element overload.
+     * @param[out] dropped Receives the number of elements skipped.
+     * @return the number of elements read.
+     */
+    template <bool OWNS_CACHE_ = true>
+    static std::size_t read_at(
+          BufferDataT& buffer_data,
+          Head& read_head,
+          Head write_head,
+          std::span<TYPE> values,
+          std::size_t& dropped) noexcept {
+        dropped = 0;
+        while (not is_empty(read_head, write_head) && not values.empty()) {
+            dropped += catch_up(read_head, write_head);
+            const auto count =
+                  std::min<std::size_t>(values.size(), distance(read_head, write_head));
+            const auto first = std::min<std::size_t>(count, N_ - read_head.index);
+            std::memcpy(values.data(), &buffer_data.data[read_head.index], first * sizeof(TYPE));
+            std::memcpy(
+                  values.data() + first,
+                  &buffer_data.data[0],
+                  (count - first) * sizeof(TYPE));
+            const auto torn = count_torn(buffer_data, read_head, count);
+            advance(read_head, count);
+            dropped += torn;
+            if (torn < count) {
+                if (torn != 0) {
+                    const auto intact = (count - torn) * sizeof(TYPE);
+                    std::memmove(values.data(), values.data() + torn, intact);
+                }
+                return count - torn;
+            }
+            write_head = reload_write_head<OWNS_CACHE_>(buffer_data);
+        }
+        return 0;
+    }
+
+    /**
+     * Moves a non-empty @p read_head forward when the writer has lapped it, so
+     * that it points to the oldest slot that has not been overwritten yet.
+     * @return the number of slots skipped.
+     */
+    static std::size_t catch_up(Head& read_head, const Head& write_head) noexcept {
+        const auto lag = distance(read_head, write_head);
+        switch (write_head.lap - read_head.lap) {
+            case 0: // same lap
+                break;
+            case 1: // one lap ahead
+                if (write_head.index > read_head.index) {
+                    read_head.index = write_head.index;
+                }
+                break;
+            default: // more than one lap ahead
+                read_head.index = write_head.index;
+                read_head.lap = write_head.lap - 1;
+        }
+        return std::size_t(lag - distance(read_head, write_head));
+    }
+
+    /**
+     * Adds a read of @p count elements that skipped @p dropped ones, with
+     * @p lag elements unread before it, to the reader statistics.
+     */
+    static void record_read(
+          BufferDataT& buffer_data,
+          const uint64_t count,
+          const uint64_t dropped,
+          const uint64_t lag) noexcept {
+        auto& stats = buffer_data.reader_stats;
+        // only the reader changes the statistics, so no read-modify-write is needed
+        const auto increase = [](uint64_t& counter, const uint64_t amount) {
+            if (amount != 0) {
+                std::atomic_ref<uint64_t> atomic(counter);
+                const auto value = atomic.load(std::memory_order_relaxed);
+                atomic.store(value + amount, std::memory_order_relaxed);
+            }
+        };
+        increase(stats.read, count);
+        increase(stats.dropped, dropped);
+        std::atomic_ref<uint64_t> max_lag(stats.max_lag);
+        if (lag > max_lag.load(std::memory_order_relaxed)) {
+            max_lag.store(lag, std::memory_order_relaxed);
+        }
+    }
+
+    /** Advances @p head by @p count slots, wrapping around and incrementing the lap counter. */
+    static void advance(Head& head, const std::size_t count) noexcept {
+        const uint64_t index = head.index + uint64_t(count);
+        head.index = uint32_t(index % N_);
+        head.lap += uint32_t(index / N_);
     }
 
     /** Advances @p head to the next slot, wrapping around and incrementing the lap counter. */
-    void advance(Head& head) noexcept {
+    static void advance(Head& head) noexcept {
         ++head.index;
         if (head.index == N_) {
             head.index = 0;
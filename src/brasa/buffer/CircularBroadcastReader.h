@@ -0,0 +1,146 @@
+#pragma once
+
+#include <brasa/buffer/Circular.h>
+
+namespace brasa::buffer {
+
+/**
+ * Read-only view over a circular buffer that keeps its position privately, so
+ * that any number of readers (threads or processes) can tail the same buffer.
+ *
+ * A `CircularReader` stores its position in the shared `read_head`, which
+ * limits a buffer to one reader. A `CircularBroadcastReader` never touches the
+ * shared read head: it only loads the write head published by the
+ * `CircularWriter` and moves its own cursor. The writer is unaware of the
+ * broadcast readers, so their number does not change its cost.
+ *
+ * A new reader starts at the current write head, i.e. it only sees elements
+ * written after its construction.
+ *
+ * **Overrun behaviour**: same as `CircularReader`. If the writer has lapped
+ * this reader, its cursor is fast-forwarded so that only recent data is
+ * returned. Each reader is overrun independently of the others.
+ *
+ * **Thread / process safety**: one writer and any number of broadcast readers
+ * are supported, each reader being used by a single thread. A shared
+ * `CircularReader` may also be used at the same time.
+ *
+ * @tparam TYPE_   Element type to read. Must satisfy the constraints of
+ *                 `detail::Circular`.
+ * @tparam N_      Buffer capacity in number of elements. Must be at least 2.
+ * @tparam LAYOUT_ Memory layout of the buffer. Must match the writer's.
+ * @tparam BLOCKING_ Whether `read_wait()` is available. Must match the writer's:
+ *                   a writer with another value resets the buffer.
+ *
+ * @see CircularWriter
+ * @see CircularReader
+ */
+template <
+      typename TYPE_,
+      size_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = detail::BufferData,
+      bool BLOCKING_ = false>
+class CircularBroadcastReader : public detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_> {
+public:
+    using Base = detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_>;
+    using Base::MIN_BUFFER_SIZE;
+    using Base::N;
+    using Base::TYPE;
+
+    /**
+     * Constructs a broadcast reader over an existing raw byte buffer,
+     * positioned at the current write head.
+     *
+     * If the buffer has not yet been initialised (key/CRC mismatch or invalid
+     * head positions), it is reset to an empty state.
+     *
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    CircularBroadcastReader(uint8_t* buffer, uint64_t key)
+          : Base(buffer, key),
+            cursor_(Base::do_write_head()) {}
+
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularBroadcastReader(uint8_t* buffer, Key<KEY_> key)
+          : Base(buffer, key),
+            cursor_(Base::do_write_head()) {}
+
+    /**
+     * Reads the next available element into @p value and advances this
+     * reader's cursor.
+     *
+     * @param[out] value Receives the element on success; unchanged on failure.
+     * @return `true` if an element was read; `false` if there is nothing new.
+     */
+    bool read(TYPE_& value) noexcept {
+        std::size_t dropped;
+        return Base::do_read(value, cursor_, dropped);
+    }
+
+    /**
+     * Same as `read(TYPE_&)`, also reporting how many elements were
+     * overwritten before this reader could read them and were skipped.
+     *
+     * @param[out] value   Receives the element on success; unchanged on failure.
+     * @param[out] dropped Receives the number of elements skipped by this read.
+     * @return `true` if an element was read; `false` if there is nothing new.
+     */
+    bool read(TYPE_& value, std::size_t& dropped) noexcept {
+        return Base::do_read(value, cursor_, dropped);
+    }
+
+    /**
+     * Reads up to `values.size()` available elements into @p values, in order,
+     * and advances this reader's cursor past them.
+     *
+     * @param[out] values Receives the elements read, starting at its first
+     *                    position; its other positions are unspecified.
+     * @return the number of elements read; 0 if there is nothing new.
+     */
+    std::size_t read(std::span<TYPE_> values) noexcept {
+        std::size_t dropped;
+        return Base::do_read(values, cursor_, dropped);
+    }
+
+    /**
+     * Same as `read(std::span<TYPE_>)`, also reporting how many elements were
+     * skipped by this read.
+     *
+     * @param[out] values  Receives the elements read, starting at its first
+     *                     position; its other positions are unspecified.
+     * @param[out] dropped Receives the number of elements skipped by this read.
+     * @return the number of elements read; 0 if there is nothing new.
+     */
+    std::size_t read(std::span<TYPE_> values, std::size_t& dropped) noexcept {
+        return Base::do_read(values, cursor_, dropped);
+    }
+
+    /**
+     * Same as `read(TYPE_&)`, but if there is nothing new blocks until the
+     * writer publishes an element or @p timeout elapses.
+     *
+     * @param[out] value Receives the element on success; unchanged on failure.
+     * @param timeout Maximum time to block.
+     * @return `true` if an element was read; `false` on timeout, or without
+     *         blocking if a non-blocking writer has reset the buffer.
+     */
+    bool read_wait(TYPE_& value, std::chrono::nanoseconds timeout) noexcept
+        requires(BLOCKING_)
+    {
+        return Base::do_read_wait(value, cursor_, timeout);
+    }
+
+private:
+    detail::Head cursor_; ///< position of the next element to read.
+};
+
+/** CircularBroadcastReader that can block in `read_wait()`; see `BlockingCircularWriter`. */
+template <typename TYPE_, size_t N_>
+using BlockingCircularBroadcastReader =
+      CircularBroadcastReader<TYPE_, N_, detail::BufferData, true>;
+} // namespace brasa::buffer
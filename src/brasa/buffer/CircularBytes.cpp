@@ -0,0 +1 @@
+#include <brasa/buffer/CircularBytes.h>
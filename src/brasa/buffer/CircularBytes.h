@@ -0,0 +1,350 @@
+#pragma once
+
+/**
+ * @file
+ * A circular buffer of @p N_ bytes that stores variable-length records in a
+ * flat @p BytesBufferData block living in caller-supplied memory (e.g. shared
+ * memory). It follows the same model as @p Circular: the block is identified by
+ * a @p key / CRC pair, the writer never blocks, and lap-based head tracking
+ * lets the reader detect when it has been overrun.
+ *
+ * Each record is stored as a 32-bit length prefix followed by the payload,
+ * padded to @p RECORD_ALIGNMENT bytes. A record never wraps around the end of
+ * the data array: when it does not fit in the remaining space, the writer
+ * leaves a padding marker there and stores the record at the start of the
+ * next lap.
+ */
+
+#include <brasa/buffer/CRC.h>
+#include <brasa/buffer/Circular.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace brasa::buffer::detail {
+
+/**
+ * Raw memory layout of the variable-length circular buffer.
+ * The heads hold byte offsets into @p data, always multiples of
+ * @p RECORD_ALIGNMENT.
+ * @tparam N_ Capacity in bytes.
+ */
+template <uint32_t N_>
+struct BytesBufferData final {
+    alignas(uint32_t) uint8_t data[N_]; ///< Ring of length-prefixed records.
+    Head write_head;                    ///< Offset and lap of the next record to write.
+    Head claim_head;                    ///< End of the record being written.
+    Head read_head;                     ///< Offset and lap of the next record to read.
+    uint64_t key;                       ///< Unique identifier used to verify buffer ownership.
+    uint32_t crc;                       ///< CRC-32 of @p key, used to detect uninitialized memory.
+};
+
+/**
+ * Base class for the variable-length circular buffer. Provides the core
+ * read/write logic and buffer-initialisation bookkeeping. Intended to be used
+ * only through the @p CircularBytesWriter and @p CircularBytesReader subclasses.
+ *
+ * **Thread / process safety:** same as @p Circular: one writer and one reader,
+ * with the heads published through release/acquire atomic accesses.
+ *
+ * **Overrun behaviour:** record boundaries are only known by walking the
+ * records from the read head, so when the writer has overwritten the record at
+ * the read head the reader cannot resynchronise in the middle of the lost
+ * data. It skips straight to the write head instead, dropping every unread
+ * record. The same happens when the writer overwrites the record while it is
+ * being copied, which the reader detects with the claim head the writer
+ * stores before writing, as in @p Circular.
+ *
+ * @tparam N_ Capacity in bytes. Must be a multiple of @p RECORD_ALIGNMENT.
+ */
+template <uint32_t N_>
+class CircularBytes {
+protected: // to allow testing and prevent use outside of the classes
+    using BufferDataT = BytesBufferData<N_>;
+    using LengthT = uint32_t;
+
+    /** Length prefix value that marks the unused tail of a lap. */
+    constexpr static LengthT PADDING = 0xffff'ffff;
+
+public:
+    /** Alignment (and size granularity) of every record in the buffer. */
+    constexpr static uint32_t RECORD_ALIGNMENT = sizeof(LengthT);
+
+    static_assert(N_ % RECORD_ALIGNMENT == 0);
+    static_assert(N_ >= 2 * RECORD_ALIGNMENT);
+    static_assert(std::is_standard_layout_v<BufferDataT>);
+    static_assert(std::is_trivially_copyable_v<BufferDataT>);
+
+    /** Buffer capacity in bytes. */
+    constexpr static uint32_t N = N_;
+    /** Largest payload that fits in the buffer. */
+    constexpr static std::size_t MAX_RECORD_SIZE = N_ - sizeof(LengthT);
+    /** Required size of the raw byte buffer. */
+    constexpr static std::size_t BUFFER_SIZE = sizeof(BufferDataT);
+    static constexpr std::size_t MIN_BUFFER_SIZE = BUFFER_SIZE + alignof(BufferDataT) - 1;
+
+    // no copies no moves
+    CircularBytes(const CircularBytes& other) = delete;
+    CircularBytes& operator=(const CircularBytes& other) = delete;
+    CircularBytes(CircularBytes&& other) = delete;
+    CircularBytes& operator=(CircularBytes&& other) = delete;
+
+    /**
+     * Returns the aligned pointer within the provided buffer.
+     *
+     * @param buffer Pointer to the raw memory buffer.
+     * @return uint8_t* First aligned pointer within the buffer.
+     */
+    static uint8_t* aligned_in_buffer(void* buffer) {
+        std::size_t space = MIN_BUFFER_SIZE;
+        std::align(alignof(BufferDataT), BUFFER_SIZE, buffer, space);
+        return static_cast<uint8_t*>(buffer);
+    }
+
+    /** Returns the number of buffer bytes taken by a record with a @p size bytes payload. */
+    constexpr static std::size_t record_size(const std::size_t size) noexcept {
+        return (sizeof(LengthT) + size + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT
+               * RECORD_ALIGNMENT;
+    }
+
+protected:
+    /**
+     * Constructs the circular buffer view over an existing byte buffer. If the
+     * buffer is not yet initialised (key/CRC mismatch or invalid heads), it is
+     * reset to an empty state.
+     *
+     * @param buffer Pointer to raw memory of at least @p MIN_BUFFER_SIZE bytes.
+     * @param key    Unique identifier for this buffer; used to detect whether
+     *               the buffer has already been initialised.
+     */
+    CircularBytes(uint8_t* buffer, const uint64_t key) : CircularBytes(buffer, key, crc32(key)) {}
+
+    /**
+     * Same as `CircularBytes(uint8_t*, uint64_t)` for a key known at compile
+     * time, whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularBytes(uint8_t* buffer, const Key<KEY_> key)
+          : CircularBytes(buffer, key.value, key.crc) {}
+
+    ~CircularBytes() noexcept = default;
+
+    /**
+     * Appends @p record to the buffer, overwriting the oldest records if there
+     * is not enough room.
+     * @param record Payload to store.
+     * @return @c false (and nothing is written) if the record is larger than
+     *         @p MAX_RECORD_SIZE; @c true otherwise.
+     */
+    bool do_write(std::span<const uint8_t> record) noexcept {
+        if (record.size() > MAX_RECORD_SIZE) {
+            return false;
+        }
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto write_head = load_head(buffer_data->write_head, std::memory_order_relaxed);
+        const auto size = record_size(record.size());
+        const bool wraps = size > N_ - write_head.index;
+        auto claim_head = wraps ? Head{ 0, write_head.lap + 1 } : write_head;
+        advance(claim_head, size);
+        store_head(buffer_data->claim_head, claim_head, std::memory_order_relaxed);
+        // orders the claim before the writes, pairing with the fence in `is_torn()`
+        std::atomic_thread_fence(std::memory_order_release);
+
+        if (wraps) {
+            store_length(*buffer_data, write_head.index, PADDING);
+            write_head = { 0, write_head.lap + 1 };
+        }
+        store_length(*buffer_data, write_head.index, LengthT(record.size()));
+        std::memcpy(
+              &buffer_data->data[write_head.index + sizeof(LengthT)],
+              record.data(),
+              record.size());
+        advance(write_head, size);
+        store_head(buffer_data->write_head, write_head, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Copies the next record into @p record and advances the read head.
+     * If the writer has overrun the reader, all unread records are dropped.
+     * @param[out] record Receives the payload on success; its contents are
+     *                    unspecified otherwise.
+     * @param[out] size   Receives the payload size on success, the size needed
+     *                    when @p record is too small, and 0 when there is
+     *                    nothing to read.
+     * @return @c true if a record was read; @c false if the buffer is empty,
+     *         the reader resynchronised on the write head, or @p record is
+     *         too small (in which case the record is kept).
+     */
+    bool do_read(std::span<uint8_t> record, std::size_t& size) noexcept {
+        std::size_t dropped;
+        return do_read(record, size, dropped);
+    }
+
+    /**
+     * Same as `do_read(std::span<uint8_t>, std::size_t&)`, also reporting the
+     * data lost when the reader resynchronises on the write head.
+     * @param[out] dropped Receives the number of written bytes skipped without
+     *                     being read (length prefixes and padding included);
+     *                     0 unless the reader resynchronised.
+     */
+    bool do_read(std::span<uint8_t> record, std::size_t& size, std::size_t& dropped) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        auto read_head = load_head(buffer_data->read_head, std::memory_order_relaxed);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_acquire);
+        const auto from = read_head;
+        size = 0;
+        dropped = 0;
+
+        if (distance(read_head, write_head) > N_) {
+            // overrun: the record at the read head is gone
+            dropped = distance(read_head, write_head);
+            store_head(buffer_data->read_head, write_head, std::memory_order_release);
+            return false;
+        }
+        while (not is_empty(read_head, write_head)) {
+            const auto length = load_length(*buffer_data, read_head.index);
+            if (length == PADDING) {
+                read_head = { 0, read_head.lap + 1 };
+                continue;
+            }
+            const auto used = record_size(length);
+            if (length > MAX_RECORD_SIZE || used > N_ - read_head.index
+                || used > distance(read_head, write_head)) {
+                // inconsistent length prefix: resynchronise on the write head
+                dropped = distance(read_head, write_head);
+                store_head(buffer_data->read_head, write_head, std::memory_order_release);
+                return false;
+            }
+            size = length;
+            if (record.size() < length) {
+                if (is_torn(*buffer_data, from)) {
+                    break;
+                }
+                store_head(buffer_data->read_head, read_head, std::memory_order_release);
+                return false;
+            }
+            const auto payload = read_head.index + sizeof(LengthT);
+            std::memcpy(record.data(), &buffer_data->data[payload], length);
+            if (is_torn(*buffer_data, from)) {
+                break;
+            }
+            advance(read_head, used);
+            store_head(buffer_data->read_head, read_head, std::memory_order_release);
+            return true;
+        }
+        if (not is_empty(read_head, write_head)) {
+            // torn: what was read from `from` may have been overwritten
+            size = 0;
+            const auto resync = load_head(buffer_data->write_head, std::memory_order_acquire);
+            dropped = distance(read_head, resync);
+            read_head = resync;
+        }
+        store_head(buffer_data->read_head, read_head, std::memory_order_release);
+        return false;
+    }
+
+private:
+    /** Constructs the view for @p key, whose CRC-32 is @p crc. */
+    CircularBytes(uint8_t* buffer, const uint64_t key, const uint32_t crc)
+          : buffer_(aligned_in_buffer(buffer)),
+            key_(key),
+            crc_(crc) {
+        if (not is_initialized()) {
+            initialize();
+        }
+    }
+
+    uint8_t* buffer_;
+    const uint64_t key_;
+    const uint32_t crc_;
+
+    /** Returns @c true if @p head holds a valid record offset. */
+    [[nodiscard]] static bool is_valid(const Head& head) noexcept {
+        return head.index < N_ && head.index % RECORD_ALIGNMENT == 0;
+    }
+
+    /**
+     * Returns @c true if the bytes read from @p from may have been overwritten
+     * while they were copied, i.e. if the writer has claimed them for its
+     * next lap.
+     */
+    static bool is_torn(BufferDataT& buffer_data, const Head& from) noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto claim_head = load_head(buffer_data.claim_head, std::memory_order_relaxed);
+        return distance(from, claim_head) > N_;
+    }
+
+    /** Returns @c true if the read/write head pair describes a consistent state. */
+    [[nodiscard]] static bool is_valid(const Head& read_head, const Head& write_head) noexcept {
+        return is_valid(read_head) && is_valid(write_head) && read_head.lap <= write_head.lap
+               && (read_head.lap != write_head.lap || read_head.index <= write_head.index);
+    }
+
+    /**
+     * Returns @c true if the buffer's key, CRC, and head positions are all
+     * consistent with this instance.
+     */
+    [[nodiscard]] bool is_initialized() const noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto read_head = load_head(buffer_data->read_head, std::memory_order_acquire);
+        const auto write_head = load_head(buffer_data->write_head, std::memory_order_acquire);
+        const auto claim_head = load_head(buffer_data->claim_head, std::memory_order_acquire);
+        return is_valid(read_head, write_head) && is_valid(write_head, claim_head)
+               && distance(write_head, claim_head) <= N_ && buffer_data->key == key_
+               && buffer_data->crc == crc_;
+    }
+
+    /** Resets the buffer to an empty state and stamps it with @p key_ and @p crc_. */
+    void initialize() noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        constexpr Head zero = { 0, 0 };
+
+        store_head(buffer_data->read_head, zero, std::memory_order_relaxed);
+        store_head(buffer_data->write_head, zero, std::memory_order_relaxed);
+        store_head(buffer_data->claim_head, zero, std::memory_order_relaxed);
+        buffer_data->key = key_;
+        buffer_data->crc = crc_;
+    }
+
+    /** Returns @c true if there is nothing to read between @p read_head and @p write_head. */
+    static bool is_empty(const Head& read_head, const Head& write_head) noexcept {
+        return read_head.index == write_head.index && read_head.lap == write_head.lap;
+    }
+
+    /** Returns the number of bytes from @p read_head up to @p write_head. */
+    static uint64_t distance(const Head& read_head, const Head& write_head) noexcept {
+        return uint64_t(uint32_t(write_head.lap - read_head.lap)) * N_ + write_head.index
+               - read_head.index;
+    }
+
+    /** Advances @p head by @p size bytes of a record that does not cross the end of the lap. */
+    static void advance(Head& head, const std::size_t size) noexcept {
+        head.index += uint32_t(size);
+        if (head.index == N_) {
+            head.index = 0;
+            ++head.lap;
+        }
+    }
+
+    /** Writes the length prefix at @p offset. */
+    static void store_length(
+          BufferDataT& buffer_data,
+          const uint32_t offset,
+          const LengthT length) noexcept {
+        std::memcpy(&buffer_data.data[offset], &length, sizeof(length));
+    }
+
+    /** Reads the length prefix at @p offset. */
+    static LengthT load_length(const BufferDataT& buffer_data, const uint32_t offset) noexcept {
+        LengthT length;
+        std::memcpy(&length, &buffer_data.data[offset], sizeof(length));
+        return length;
+    }
+};
+} // namespace brasa::buffer::detail
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <brasa/buffer/CircularBytes.h>
+
+namespace brasa::buffer {
+
+/**
+ * Read-only view over a variable-length circular buffer stored in
+ * caller-supplied memory.
+ *
+ * **Overrun behaviour**: records are found by walking their length prefixes,
+ * so once the writer has overwritten the record at the read head there is no
+ * way to find the next record boundary inside the lost data. The reader then
+ * skips to the write head, dropping all unread records, and the next `read()`
+ * returns the first record written after that point.
+ *
+ * **Thread / process safety**: concurrent access by exactly one writer and one
+ * reader is supported. Multiple concurrent readers are *not* supported.
+ *
+ * @tparam N_ Buffer capacity in bytes. Must be a multiple of
+ *            `RECORD_ALIGNMENT`.
+ *
+ * @see CircularBytesWriter
+ * @see detail::CircularBytes
+ */
+template <uint32_t N_>
+class CircularBytesReader : public detail::CircularBytes<N_> {
+public:
+    using Base = detail::CircularBytes<N_>;
+    using Base::MAX_RECORD_SIZE;
+    using Base::MIN_BUFFER_SIZE;
+    using Base::N;
+
+    /**
+     * Constructs a reader over an existing raw byte buffer.
+     *
+     * If the buffer has not yet been initialised (key/CRC mismatch or invalid
+     * head positions), it is reset to an empty state. Otherwise the existing
+     * content is left intact, allowing the reader to resume after a restart.
+     *
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    CircularBytesReader(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
+
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularBytesReader(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
+    /**
+     * Copies the next record into @p record and advances the read head.
+     *
+     * A buffer of `MAX_RECORD_SIZE` bytes is always large enough. If @p record
+     * is too small, the record is left in the buffer and @p size tells how
+     * many bytes are needed.
+     *
+     * A `false` return does not always mean that the buffer is empty: it is
+     * also returned when the reader was overrun, or found a record torn by the
+     * writer, and resynchronised on the write head. Records written after that
+     * point can be read at once, so a drain loop that must not stop on a loss
+     * should use the overload that reports the dropped bytes.
+     *
+     * @param[out] record Receives the payload on success; its contents are
+     *                    unspecified on failure.
+     * @param[out] size   Payload size on success; needed size if @p record is
+     *                    too small; 0 if there is nothing to read.
+     * @return `true` if a record was read; `false` otherwise.
+     */
+    bool read(std::span<uint8_t> record, std::size_t& size) noexcept {
+        return Base::do_read(record, size);
+    }
+
+    /**
+     * Same as `read(std::span<uint8_t>, std::size_t&)`, also reporting how
+     * much unread data was skipped when the reader resynchronised. A drain
+     * loop can go on while a record is read or @p dropped is not 0.
+     *
+     * @param[out] record  Receives the payload on success; its contents are
+     *                     unspecified on failure.
+     * @param[out] size    Payload size on success; needed size if @p record is
+     *                     too small; 0 otherwise.
+     * @param[out] dropped Number of written bytes (length prefixes and padding
+     *                     included) skipped without being read; 0 unless this
+     *                     call resynchronised on the write head.
+     * @return `true` if a record was read; `false` otherwise.
+     */
+    bool read(std::span<uint8_t> record, std::size_t& size, std::size_t& dropped) noexcept {
+        return Base::do_read(record, size, dropped);
+    }
+};
+} // namespace brasa::buffer
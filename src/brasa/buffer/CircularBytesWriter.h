@@ -0,0 +1,68 @@
+#pragma once
+
+#include <brasa/buffer/CircularBytes.h>
+
+namespace brasa::buffer {
+
+/**
+ * Write-only view over a variable-length circular buffer stored in
+ * caller-supplied memory.
+ *
+ * `CircularBytesWriter` and `CircularBytesReader` are the byte-oriented
+ * counterparts of `CircularWriter` and `CircularReader`: instead of fixed-size
+ * `TYPE_` slots, each write stores one length-prefixed record, so that a
+ * stream of mixed-size messages does not need every slot sized for the
+ * largest one.
+ *
+ * **Overrun behaviour**: when the buffer is full the oldest unread records are
+ * silently overwritten. See `CircularBytesReader` for how the reader recovers.
+ *
+ * **Thread / process safety**: concurrent access by exactly one writer and one
+ * reader is supported. Multiple concurrent writers are *not* supported.
+ *
+ * @tparam N_ Buffer capacity in bytes. Must be a multiple of
+ *            `RECORD_ALIGNMENT`.
+ *
+ * @see CircularBytesReader
+ * @see detail::CircularBytes
+ */
+template <uint32_t N_>
+class CircularBytesWriter : public detail::CircularBytes<N_> {
+public:
+    using Base = detail::CircularBytes<N_>;
+    using Base::MAX_RECORD_SIZE;
+    using Base::MIN_BUFFER_SIZE;
+    using Base::N;
+
+    /**
+     * Constructs a writer over an existing raw byte buffer.
+     *
+     * If the buffer has not yet been initialised (key/CRC mismatch or invalid
+     * head positions), it is reset to an empty state. Otherwise the existing
+     * content is left intact, allowing the writer to resume after a restart.
+     *
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    CircularBytesWriter(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
+
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularBytesWriter(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
+    /**
+     * Appends @p record to the buffer.
+     *
+     * If there is not enough room the oldest unread records are silently
+     * overwritten. The operation never blocks.
+     *
+     * @param record Payload to store. It is copied into the buffer.
+     * @return `false` if the record is larger than `MAX_RECORD_SIZE` (nothing
+     *         is written); `true` otherwise.
+     */
+    bool write(std::span<const uint8_t> record) noexcept { return Base::do_write(record); }
+};
+} // namespace brasa::buffer
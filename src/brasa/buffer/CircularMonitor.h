@@ -0,0 +1,96 @@
+#pragma once
+
+#include <brasa/buffer/CRC.h>
+#include <brasa/buffer/Circular.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace brasa::buffer {
+
+/** Snapshot of the activity of a circular buffer, as seen by `CircularMonitor`. */
+struct CircularStats final {
+    uint64_t written; ///< Number of elements written.
+    uint64_t read;    ///< Number of elements read by the (shared) reader.
+    uint64_t dropped; ///< Number of elements overwritten before being read.
+    uint64_t max_lag; ///< Largest number of unread elements observed by a read.
+    uint64_t lag;     ///< Number of elements currently unread (may exceed `N`).
+};
+
+/**
+ * Read-only observer of a circular buffer, meant for a third process that
+ * watches a `CircularWriter` / `CircularReader` pair.
+ *
+ * It never writes to the buffer (it does not even initialise it) and only
+ * loads the heads and the statistics kept by the reader, so it disturbs
+ * neither the writer nor the reader beyond sharing their cache lines.
+ *
+ * **Thread / process safety**: any number of monitors may watch a buffer
+ * concurrently with its writer and reader. Each value is loaded atomically, but
+ * a snapshot is not: e.g. `read` may already include an element that `written`
+ * does not yet count.
+ *
+ * @tparam TYPE_   Element type of the buffer.
+ * @tparam N_      Buffer capacity in number of elements.
+ * @tparam LAYOUT_ Memory layout of the buffer; must match the writer's.
+ *
+ * @see CircularReader
+ */
+template <
+      typename TYPE_,
+      size_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = detail::BufferData>
+class CircularMonitor {
+public:
+    using BufferDataT = LAYOUT_<TYPE_, N_>;
+
+    /**
+     * Constructs a monitor over a raw byte buffer shared with the writer.
+     *
+     * @param buffer Pointer to the raw memory given to the writer.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    CircularMonitor(uint8_t* buffer, uint64_t key)
+          : buffer_data_(reinterpret_cast<BufferDataT*>(
+                  detail::Circular<TYPE_, N_, LAYOUT_>::aligned_in_buffer(buffer))),
+            key_(key) {}
+
+    /** Returns `true` if the buffer has been initialised with this monitor's key. */
+    [[nodiscard]] bool is_initialized() const noexcept {
+        return buffer_data_->key == key_ && buffer_data_->crc == detail::crc32(key_);
+    }
+
+    /** Returns the current statistics of the buffer; all zero if it is not initialised. */
+    CircularStats stats() const noexcept {
+        if (not is_initialized()) {
+            return {};
+        }
+        const auto& stats = buffer_data_->reader_stats;
+        const auto write_head =
+              detail::load_head(buffer_data_->write_head, std::memory_order_relaxed);
+        const auto read_head =
+              detail::load_head(buffer_data_->read_head, std::memory_order_relaxed);
+        return {
+            .written = position(write_head),
+            .read = load(stats.read),
+            .dropped = load(stats.dropped),
+            .max_lag = load(stats.max_lag),
+            .lag = position(write_head) - position(read_head),
+        };
+    }
+
+private:
+    BufferDataT* buffer_data_;
+    const uint64_t key_;
+
+    /** Returns the number of elements before @p head since the buffer was initialised. */
+    static uint64_t position(const detail::Head& head) noexcept {
+        return uint64_t(head.lap) * N_ + head.index;
+    }
+
+    static uint64_t load(const uint64_t& counter) noexcept {
+        return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(counter))
+              .load(std::memory_order_relaxed);
+    }
+};
+} // namespace brasa::buffer
@@ -15,7 +15,9 @@ namespace brasa::buffer {
  *
  * **Overrun behaviour**: if the writer has advanced more than one full lap
  * ahead of the reader, the read head is fast-forwarded so that only recent data
- * is returned -- stale slots are skipped silently.
+ * is returned -- stale slots are skipped silently. An element that the writer
+ * overwrites while it is being copied is skipped as well, so `read()` never
+ * returns a torn element.
  *
  * **Thread / process safety**: concurrent access by exactly one writer and one
  * reader is supported. Multiple concurrent readers are *not* supported.
@@ -24,14 +26,23 @@ namespace brasa::buffer {
  *               `detail::Circular` (copy/nothrow-move constructible and
  *               assignable, standard-layout, trivially copyable).
  * @tparam N_    Buffer capacity in number of elements. Must be at least 2.
+ * @tparam LAYOUT_ Memory layout of the buffer (`detail::BufferData` or
+ *                 `detail::BufferDataPadded`). Writer and reader must agree.
+ * @tparam BLOCKING_ Whether `read_wait()` is available. It is stored in the
+ *                   buffer: a writer with another value resets the buffer,
+ *                   as a different key does.
  *
  * @see CircularWriter
  * @see detail::Circular
  */
-template <typename TYPE_, size_t N_>
-class CircularReader : public detail::Circular<TYPE_, N_> {
+template <
+      typename TYPE_,
+      size_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = detail::BufferData,
+      bool BLOCKING_ = false>
+class CircularReader : public detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_> {
 public:
-    using Base = detail::Circular<TYPE_, N_>;
+    using Base = detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_>;
     using Base::MIN_BUFFER_SIZE;
     using Base::N;
     using Base::TYPE;
@@ -43,8 +54,7 @@ public:
      * head positions), it is reset to an empty state. Otherwise the existing
      * content is left intact, allowing the reader to resume after a restart.
      *
-     * @param buffer Pointer to raw memory of at least `BUFFER_SIZE` bytes,
-     *               aligned to `alignof(detail::BufferData<TYPE_, N_>)`.
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
      * @param key    Unique identifier for this buffer instance, used to detect
      *               whether the buffer has already been initialised by a
      *               compatible writer/reader pair.
@@ -53,6 +63,13 @@ public:
      */
     CircularReader(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
 
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularReader(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
     /**
      * Reads the next available element into @p value and advances the read head.
      *
@@ -63,5 +80,103 @@ public:
      * @return `true` if an element was read; `false` if the buffer is empty.
      */
     bool read(TYPE_& value) noexcept { return Base::do_read(value); }
+
+    /**
+     * Same as `read(TYPE_&)`, also reporting how many elements were
+     * overwritten before they could be read and were skipped by this read.
+     *
+     * The cumulative counts are kept in the buffer (see `CircularMonitor`).
+     *
+     * @param[out] value   Receives the element on success; unchanged on failure.
+     * @param[out] dropped Receives the number of elements skipped by this read.
+     * @return `true` if an element was read; `false` if the buffer is empty.
+     */
+    bool read(TYPE_& value, std::size_t& dropped) noexcept {
+        return Base::do_read(value, dropped);
+    }
+
+    /**
+     * Reads up to `values.size()` available elements into @p values, in order,
+     * and advances the read head once for the whole batch.
+     *
+     * Overruns are handled as in the single element overload.
+     *
+     * @param[out] values Receives the elements read, starting at its first
+     *                    position; its other positions are unspecified.
+     * @return the number of elements read; 0 if the buffer is empty.
+     */
+    std::size_t read(std::span<TYPE_> values) noexcept { return Base::do_read(values); }
+
+    /**
+     * Same as `read(std::span<TYPE_>)`, also reporting how many elements were
+     * skipped by this read.
+     *
+     * @param[out] values  Receives the elements read, starting at its first
+     *                     position; its other positions are unspecified.
+     * @param[out] dropped Receives the number of elements skipped by this read.
+     * @return the number of elements read; 0 if the buffer is empty.
+     */
+    std::size_t read(std::span<TYPE_> values, std::size_t& dropped) noexcept {
+        return Base::do_read(values, dropped);
+    }
+
+    /**
+     * Same as `read(TYPE_&)`, but if the buffer is empty blocks until the
+     * writer publishes an element or @p timeout elapses, instead of spinning or
+     * sleeping for a fixed time.
+     *
+     * The reader parks on the shared write head (a futex in the buffer), so it
+     * is woken by the writer even when they live in different processes. The
+     * writer only makes the wake-up system call while a reader is blocked.
+     *
+     * @param[out] value Receives the element on success; unchanged on failure.
+     * @param timeout Maximum time to block.
+     * @return `true` if an element was read; `false` on timeout, or without
+     *         blocking if a non-blocking writer has reset the buffer.
+     */
+    bool read_wait(TYPE_& value, std::chrono::nanoseconds timeout) noexcept
+        requires(BLOCKING_)
+    {
+        return Base::do_read_wait(value, timeout);
+    }
+
+    /**
+     * Returns the consecutive readable slots starting at the read head without
+     * copying them. The run stops at the end of the buffer; peek again after
+     * releasing to get the slots past the wrap point.
+     *
+     * Overruns are handled as in `read()`. The returned slots may be
+     * overwritten by the writer if it laps the reader while they are in use;
+     * `release()` tells which ones were intact.
+     *
+     * @return the readable slots; empty if the buffer is empty.
+     */
+    std::span<const TYPE_> peek() noexcept { return Base::do_peek(); }
+
+    /**
+     * Consumes the first @p count slots returned by `peek()` with a single read
+     * head update.
+     *
+     * The slots are read in place, so the writer may overwrite some of them
+     * while they are being processed. Those are always the first ones of the
+     * run and must be discarded: only the last slots, as many as returned,
+     * were intact.
+     *
+     * @param count Number of slots consumed; must not exceed the peeked size.
+     * @return the number of intact slots at the end of the released run.
+     */
+    std::size_t release(std::size_t count) noexcept { return Base::do_release(count); }
 };
+
+/**
+ * CircularReader over the `detail::BufferDataPadded` layout, which keeps the write and
+ * read heads on separate cache lines. Use it when writer and reader run on
+ * different cores or sockets.
+ */
+template <typename TYPE_, size_t N_>
+using PaddedCircularReader = CircularReader<TYPE_, N_, detail::BufferDataPadded>;
+
+/** CircularReader that can block in `read_wait()`; see `BlockingCircularWriter`. */
+template <typename TYPE_, size_t N_>
+using BlockingCircularReader = CircularReader<TYPE_, N_, detail::BufferData, true>;
 } // namespace brasa::buffer
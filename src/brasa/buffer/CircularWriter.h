@@ -24,14 +24,25 @@ namespace brasa::buffer {
  *               `detail::Circular` (copy/nothrow-move constructible and
  *               assignable, standard-layout, trivially copyable).
  * @tparam N_    Buffer capacity in number of elements. Must be at least 2.
+ * @tparam LAYOUT_ Memory layout of the buffer (`detail::BufferData` or
+ *                 `detail::BufferDataPadded`). Writer and reader must agree.
+ * @tparam BLOCKING_ Whether readers may block in `read_wait()`. The writer of
+ *                   a blocking buffer pays a full memory fence on every
+ *                   `write()` and `commit()`, so leave it off unless readers
+ *                   wait. It is stored in the buffer: a reader with another
+ *                   value resets the buffer, as a different key does.
  *
  * @see CircularReader
  * @see detail::Circular
  */
-template <typename TYPE_, size_t N_>
-class CircularWriter : public detail::Circular<TYPE_, N_> {
+template <
+      typename TYPE_,
+      size_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = detail::BufferData,
+      bool BLOCKING_ = false>
+class CircularWriter : public detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_> {
 public:
-    using Base = detail::Circular<TYPE_, N_>;
+    using Base = detail::Circular<TYPE_, N_, LAYOUT_, BLOCKING_>;
     using Base::MIN_BUFFER_SIZE;
     using Base::N;
     using Base::TYPE;
@@ -43,8 +54,7 @@ public:
      * head positions), it is reset to an empty state. Otherwise the existing
      * content is left intact, allowing the writer to resume after a restart.
      *
-     * @param buffer Pointer to raw memory of at least `BUFFER_SIZE` bytes,
-     *               aligned to `alignof(detail::BufferData<TYPE_, N_>)`.
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
      * @param key    Unique identifier for this buffer instance, used to detect
      *               whether the buffer has already been initialised by a
      *               compatible writer/reader pair.
@@ -53,6 +63,13 @@ public:
      */
     CircularWriter(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
 
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    CircularWriter(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
     /**
      * Writes @p value into the next available slot and advances the write head.
      *
@@ -62,5 +79,63 @@ public:
      * @param value Element to store. The value is copied into the buffer.
      */
     void write(const TYPE_& value) noexcept { Base::do_write(value); }
+
+    /**
+     * Writes all @p values into consecutive slots and advances the write head
+     * once for the whole batch, so the reader sees either none or all of them.
+     *
+     * If the batch is larger than the buffer only its last `N` elements are
+     * kept. The operation is always successful and never blocks.
+     *
+     * @param values Elements to store, in order. They are copied into the buffer.
+     */
+    void write(std::span<const TYPE_> values) noexcept { Base::do_write(values); }
+
+    /**
+     * Returns the next slot of the buffer so that a value can be built in
+     * place, avoiding the copy made by `write()`. The value becomes visible to
+     * the reader only after `commit()`.
+     *
+     * @return reference to the slot at the write head.
+     */
+    TYPE_& claim() noexcept { return Base::do_claim(1)[0]; }
+
+    /**
+     * Returns up to @p count consecutive slots starting at the write head so
+     * that values can be built in place. The run stops at the end of the
+     * buffer, so fewer slots than requested may be returned; claim again after
+     * committing to get the slots past the wrap point.
+     *
+     * @param count Number of slots wanted.
+     * @return the claimed slots; never empty when @p count > 0.
+     */
+    std::span<TYPE_> claim(std::size_t count) noexcept { return Base::do_claim(count); }
+
+    /**
+     * Publishes the first @p count claimed slots to the reader with a single
+     * write head update.
+     *
+     * The claimed slots that are not published still hold the elements of the
+     * previous lap, which a lagging reader may read, so they should not be
+     * modified.
+     *
+     * @param count Number of slots to publish; must not exceed the claimed size.
+     */
+    void commit(std::size_t count = 1) noexcept { Base::do_commit(count); }
 };
+
+/**
+ * CircularWriter over the `detail::BufferDataPadded` layout, which keeps the write and
+ * read heads on separate cache lines. Use it when writer and reader run on
+ * different cores or sockets.
+ */
+template <typename TYPE_, size_t N_>
+using PaddedCircularWriter = CircularWriter<TYPE_, N_, detail::BufferDataPadded>;
+
+/**
+ * CircularWriter that wakes the readers blocked in `read_wait()`, at the cost
+ * of a full memory fence per write.
+ */
+template <typename TYPE_, size_t N_>
+using BlockingCircularWriter = CircularWriter<TYPE_, N_, detail::BufferData, true>;
 } // namespace brasa::buffer
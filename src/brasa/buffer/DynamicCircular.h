@@ -0,0 +1,211 @@
+#pragma once
+
+/**
+ * @file
+ * A circular buffer whose capacity is chosen at run time and recorded in the
+ * shared header, so that a reader can attach to it without knowing the
+ * capacity at compile time. It follows the same model as @p Circular: the
+ * block lives in caller-supplied memory, is identified by a @p key / CRC pair,
+ * the writer never blocks and the reader detects when it has been overrun.
+ *
+ * The capacity is rounded up to a power of two and the heads are 64-bit
+ * counters of elements written / read, so the slot of a position is found with
+ * a mask and advancing a head is a plain increment.
+ */
+
+#include <brasa/buffer/CRC.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace brasa::buffer::detail {
+
+/**
+ * Raw memory layout of the header of a runtime-capacity circular buffer. The
+ * `capacity` elements follow it, at the first offset aligned for the element
+ * type.
+ */
+struct DynamicBufferHeader final {
+    uint64_t write_position; ///< Number of elements written since initialisation.
+    uint64_t read_position;  ///< Number of elements read or skipped by the reader.
+    uint64_t key;            ///< Unique identifier used to verify buffer ownership.
+    uint32_t crc;            ///< CRC-32 of @p key, used to detect uninitialized memory.
+    uint32_t capacity;       ///< Number of elements in the ring; a power of two.
+    uint32_t element_size;   ///< Size of each element, checked when attaching.
+};
+static_assert(std::is_trivial_v<DynamicBufferHeader>, "DynamicBufferHeader must remain a POD");
+static_assert(std::atomic_ref<uint64_t>::is_always_lock_free);
+
+/**
+ * Base class for the runtime-capacity circular buffer. Provides the core
+ * read/write logic and buffer-initialisation bookkeeping. Intended to be used
+ * only through the @p DynamicCircularWriter and @p DynamicCircularReader
+ * subclasses.
+ *
+ * **Thread / process safety:** same as @p Circular: one writer and one reader,
+ * with the positions published through release/acquire atomic accesses.
+ *
+ * **Overrun behaviour:** if the writer is more than one lap ahead, the reader
+ * skips to the oldest element still in the buffer.
+ *
+ * @tparam TYPE_ Element type. Must be trivially copyable.
+ */
+template <typename TYPE_>
+class DynamicCircular {
+protected: // to allow testing and prevent use outside of the classes
+    using HeaderT = DynamicBufferHeader;
+
+    /** Offset of the first element from the start of the header. */
+    constexpr static std::size_t DATA_OFFSET =
+          (sizeof(HeaderT) + alignof(TYPE_) - 1) / alignof(TYPE_) * alignof(TYPE_);
+    constexpr static std::size_t ALIGNMENT = std::max(alignof(HeaderT), alignof(TYPE_));
+
+public:
+    static_assert(std::is_trivially_copyable_v<TYPE_>);
+
+    using TYPE = TYPE_;
+
+    /** Smallest capacity of a buffer. */
+    constexpr static uint32_t MIN_CAPACITY = 2;
+    /** Largest capacity of a buffer. */
+    constexpr static uint32_t MAX_CAPACITY = uint32_t(1) << 31;
+
+    // no copies no moves
+    DynamicCircular(const DynamicCircular& other) = delete;
+    DynamicCircular& operator=(const DynamicCircular& other) = delete;
+    DynamicCircular(DynamicCircular&& other) = delete;
+    DynamicCircular& operator=(DynamicCircular&& other) = delete;
+
+    /**
+     * Returns the capacity actually used for a requested @p capacity: the next
+     * power of two, within `[MIN_CAPACITY, MAX_CAPACITY]`.
+     */
+    constexpr static uint32_t round_capacity(const std::size_t capacity) noexcept {
+        const auto clamped = std::clamp<std::size_t>(capacity, MIN_CAPACITY, MAX_CAPACITY);
+        return uint32_t(std::bit_ceil(clamped));
+    }
+
+    /**
+     * Returns the minimum size of the raw byte buffer holding @p capacity
+     * elements (before rounding), including the slack needed for alignment.
+     */
+    constexpr static std::size_t min_buffer_size(const std::size_t capacity) noexcept {
+        return DATA_OFFSET + std::size_t(round_capacity(capacity)) * sizeof(TYPE_)
+               + ALIGNMENT - 1;
+    }
+
+    /**
+     * Returns the aligned pointer within the provided buffer.
+     *
+     * @param buffer Pointer to the raw memory buffer.
+     * @return uint8_t* First aligned pointer within the buffer.
+     */
+    static uint8_t* aligned_in_buffer(void* buffer) {
+        std::size_t space = ALIGNMENT;
+        std::align(ALIGNMENT, 1, buffer, space);
+        return static_cast<uint8_t*>(buffer);
+    }
+
+    /** Returns the number of elements the buffer holds. */
+    uint32_t capacity() const noexcept { return mask_ + 1; }
+
+protected:
+    /**
+     * Constructs the writer side view over a byte buffer of at least
+     * `min_buffer_size(capacity)` bytes. If the buffer is not initialised with
+     * @p key and the rounded @p capacity, it is reset to an empty state.
+     */
+    DynamicCircular(uint8_t* buffer, const std::size_t capacity, const uint64_t key)
+          : header_(reinterpret_cast<HeaderT*>(aligned_in_buffer(buffer))),
+            data_(reinterpret_cast<TYPE*>(reinterpret_cast<uint8_t*>(header_) + DATA_OFFSET)),
+            mask_(round_capacity(capacity) - 1) {
+        if (not is_initialized(key) || header_->capacity != this->capacity()) {
+            initialize(key);
+        }
+    }
+
+    /**
+     * Constructs the reader side view over a buffer already initialised by a
+     * writer, taking the capacity from its header.
+     * @throws std::invalid_argument if the buffer was not initialised with
+     *         @p key for elements of type @p TYPE_.
+     */
+    DynamicCircular(uint8_t* buffer, const uint64_t key)
+          : header_(reinterpret_cast<HeaderT*>(aligned_in_buffer(buffer))),
+            data_(reinterpret_cast<TYPE*>(reinterpret_cast<uint8_t*>(header_) + DATA_OFFSET)),
+            mask_(header_->capacity - 1) {
+        if (not is_initialized(key)) {
+            throw std::invalid_argument("Buffer not initialised for this key and type");
+        }
+    }
+
+    ~DynamicCircular() noexcept = default;
+
+    /**
+     * Writes @p value into the next slot and advances the write head. If the
+     * buffer is full the oldest unread element is silently overwritten.
+     */
+    void do_write(const TYPE& value) noexcept {
+        std::atomic_ref<uint64_t> write_position(header_->write_position);
+        // only this writer changes the write position, so it can be read relaxed
+        const auto position = write_position.load(std::memory_order_relaxed);
+        data_[position & mask_] = value;
+        write_position.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * Reads the next available element into @p value and advances the read
+     * head, after skipping the elements that were overwritten.
+     * @return @c true if an element was read; @c false if the buffer is empty.
+     */
+    bool do_read(TYPE& value) noexcept {
+        std::atomic_ref<uint64_t> read_position(header_->read_position);
+        auto position = read_position.load(std::memory_order_relaxed);
+        const auto write_position = std::atomic_ref<uint64_t>(header_->write_position)
+                                          .load(std::memory_order_acquire);
+        if (position == write_position) {
+            return false;
+        }
+        if (write_position - position > capacity()) {
+            position = write_position - capacity(); // overrun: skip the lost elements
+        }
+        value = data_[position & mask_];
+        read_position.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    HeaderT* header_;
+    TYPE* data_;
+    const uint32_t mask_;
+
+    /**
+     * Returns @c true if the header's key, CRC, element size, capacity and
+     * positions are all consistent with @p key and @p TYPE_.
+     */
+    [[nodiscard]] bool is_initialized(const uint64_t key) const noexcept {
+        const auto read_position =
+              std::atomic_ref<uint64_t>(header_->read_position).load(std::memory_order_acquire);
+        const auto write_position =
+              std::atomic_ref<uint64_t>(header_->write_position).load(std::memory_order_acquire);
+        return header_->key == key && header_->crc == crc32(key)
+               && header_->element_size == sizeof(TYPE_) && header_->capacity >= MIN_CAPACITY
+               && std::has_single_bit(header_->capacity) && read_position <= write_position;
+    }
+
+    /** Resets the buffer to an empty state with this view's capacity and @p key. */
+    void initialize(const uint64_t key) noexcept {
+        header_->write_position = 0;
+        header_->read_position = 0;
+        header_->key = key;
+        header_->crc = crc32(key);
+        header_->capacity = capacity();
+        header_->element_size = sizeof(TYPE_);
+    }
+};
+} // namespace brasa::buffer::detail
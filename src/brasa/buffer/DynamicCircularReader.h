@@ -0,0 +1,50 @@
+#pragma once
+
+#include <brasa/buffer/DynamicCircular.h>
+
+namespace brasa::buffer {
+
+/**
+ * Read-only view over a circular buffer whose capacity is chosen at run time
+ * by its `DynamicCircularWriter`.
+ *
+ * The capacity is read from the buffer header, so the reader does not need to
+ * know it at compile time and the buffer must already have been initialised
+ * by a writer.
+ *
+ * **Overrun behaviour**: if the writer has advanced more than one full lap
+ * ahead of the reader, the overwritten elements are skipped silently.
+ *
+ * **Thread / process safety**: concurrent access by exactly one writer and one
+ * reader is supported.
+ *
+ * @tparam TYPE_ Element type to read. Must match the writer's.
+ *
+ * @see DynamicCircularWriter
+ * @see detail::DynamicCircular
+ */
+template <typename TYPE_>
+class DynamicCircularReader : public detail::DynamicCircular<TYPE_> {
+public:
+    using Base = detail::DynamicCircular<TYPE_>;
+    using Base::TYPE;
+
+    /**
+     * Attaches a reader to a buffer initialised by a `DynamicCircularWriter`.
+     *
+     * @param buffer Pointer to the raw memory given to the writer.
+     * @param key    Unique identifier for this buffer instance.
+     * @throws std::invalid_argument if the buffer was not initialised with
+     *         @p key for elements of the same size as @p TYPE_.
+     */
+    DynamicCircularReader(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
+
+    /**
+     * Reads the next available element into @p value.
+     *
+     * @param[out] value Receives the element on success; unchanged on failure.
+     * @return `true` if an element was read; `false` if the buffer is empty.
+     */
+    bool read(TYPE_& value) noexcept { return Base::do_read(value); }
+};
+} // namespace brasa::buffer
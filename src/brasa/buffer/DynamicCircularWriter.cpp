@@ -0,0 +1 @@
+#include <brasa/buffer/DynamicCircularWriter.h>
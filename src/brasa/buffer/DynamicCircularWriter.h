@@ -0,0 +1,50 @@
+#pragma once
+
+#include <brasa/buffer/DynamicCircular.h>
+
+namespace brasa::buffer {
+
+/**
+ * Write-only view over a circular buffer whose capacity is chosen at run time.
+ *
+ * It behaves as `CircularWriter` (writes always succeed, overwriting the
+ * oldest elements when the buffer is full), but the capacity is a constructor
+ * argument, rounded up to a power of two and stored in the buffer header for
+ * the readers.
+ *
+ * **Thread / process safety**: concurrent access by exactly one writer and one
+ * reader is supported.
+ *
+ * @tparam TYPE_ Element type to write. Must be trivially copyable.
+ *
+ * @see DynamicCircularReader
+ * @see detail::DynamicCircular
+ */
+template <typename TYPE_>
+class DynamicCircularWriter : public detail::DynamicCircular<TYPE_> {
+public:
+    using Base = detail::DynamicCircular<TYPE_>;
+    using Base::TYPE;
+
+    /**
+     * Constructs a writer over a raw byte buffer.
+     *
+     * If the buffer has not yet been initialised with @p key, @p TYPE_ and the
+     * same (rounded) capacity, it is reset to an empty state. Otherwise the
+     * existing content is left intact.
+     *
+     * @param buffer   Pointer to raw memory of at least
+     *                 `min_buffer_size(capacity)` bytes.
+     * @param capacity Wanted number of elements; rounded up to a power of two.
+     * @param key      Unique identifier for this buffer instance.
+     */
+    DynamicCircularWriter(uint8_t* buffer, std::size_t capacity, uint64_t key)
+          : Base(buffer, capacity, key) {}
+
+    /**
+     * Stores @p value into the next slot. It **always succeeds**, overwriting
+     * the oldest element if the buffer is full.
+     */
+    void write(const TYPE_& value) noexcept { Base::do_write(value); }
+};
+} // namespace brasa::buffer
@@ -0,0 +1,28 @@
+#include <brasa/buffer/Futex.h>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+
+namespace brasa::buffer::detail {
+
+bool futex_wait(
+      uint32_t& word,
+      const uint32_t expected,
+      const std::chrono::nanoseconds timeout) noexcept {
+    using namespace std::chrono;
+    const auto secs = duration_cast<seconds>(timeout);
+    const timespec relative = { time_t(secs.count()), long((timeout - secs).count()) };
+    // FUTEX_WAIT (not FUTEX_WAIT_PRIVATE) so that other processes can wake us
+    const auto result = ::syscall(SYS_futex, &word, FUTEX_WAIT, expected, &relative, nullptr, 0);
+    return result == 0 || errno != ETIMEDOUT;
+}
+
+void futex_wake_all(uint32_t& word) noexcept {
+    ::syscall(SYS_futex, &word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+} // namespace brasa::buffer::detail
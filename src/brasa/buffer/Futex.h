@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @file
+ * Thin wrappers over the Linux `futex` system call, used to park a reader on a
+ * word of a buffer living in shared memory. Unlike `std::atomic::wait`, whose
+ * implementation is free to use process-private futexes or a global table of
+ * waiters, these always use shared futexes, so a waiter can be woken by
+ * another process that maps the same memory.
+ */
+
+#include <chrono>
+#include <cstdint>
+
+namespace brasa::buffer::detail {
+
+/**
+ * Blocks the calling thread while @p word holds @p expected, until woken by
+ * `futex_wake_all()` or until @p timeout elapses. May also return spuriously,
+ * so the caller must re-check its condition.
+ *
+ * @param word     Word to wait on; may live in memory shared between processes.
+ * @param expected Value @p word must hold for the thread to block.
+ * @param timeout  Maximum time to block.
+ * @return @c false if the wait timed out; @c true otherwise (woken, @p word
+ *         did not hold @p expected, or interrupted).
+ */
+bool futex_wait(uint32_t& word, uint32_t expected, std::chrono::nanoseconds timeout) noexcept;
+
+/** Wakes every thread blocked in `futex_wait()` on @p word, in any process. */
+void futex_wake_all(uint32_t& word) noexcept;
+} // namespace brasa::buffer::detail
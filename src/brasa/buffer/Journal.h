@@ -0,0 +1,332 @@
+#pragma once
+
+/**
+ * @file
+ * Circular buffer kept in a memory-mapped file, so that its last `N` records
+ * survive a crash of the host and not only of the processes using it.
+ */
+
+#include <brasa/buffer/CRC.h>
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace brasa::buffer {
+
+/** When a `Journal` flushes its records to the file with `msync`. */
+enum class JournalSync {
+    NEVER,   ///< Only when asked with `Journal::sync()`; the kernel writes back on its own.
+    EVERY,   ///< After every `JournalOptions::every` writes.
+    PERIODIC ///< On the first write after `JournalOptions::period` since the last flush.
+};
+
+/** How a `Journal` persists its records. */
+struct JournalOptions final {
+    JournalSync sync = JournalSync::NEVER;
+    /** Number of writes between two flushes for `JournalSync::EVERY`. */
+    uint32_t every = 1;
+    /** Minimum time between two flushes for `JournalSync::PERIODIC`. */
+    std::chrono::nanoseconds period = std::chrono::milliseconds(10);
+};
+
+/**
+ * Slot of a `Journal`: the value, the position it was written at and a CRC-32
+ * of both, so that recovery can tell intact records from torn or stale ones.
+ */
+template <typename TYPE_>
+struct JournalRecord final {
+    uint64_t sequence; ///< Number of records written before this one.
+    TYPE_ value;       ///< Value written by the user.
+    uint32_t crc;      ///< CRC-32 of the bytes before this field.
+
+    /** Returns @c true if @p crc matches the content of the record. */
+    [[nodiscard]] bool is_valid() const noexcept { return crc == checksum(); }
+
+    /** Returns the CRC-32 of the bytes of the record before @p crc. */
+    uint32_t checksum() const noexcept {
+        return detail::crc32(reinterpret_cast<const uint8_t*>(this), offsetof(JournalRecord, crc));
+    }
+};
+
+/**
+ * Circular buffer of `JournalRecord`s stored in a file mapped with
+ * `MAP_SHARED`, written in place instead of being copied to disk by a separate
+ * thread.
+ *
+ * The file holds a plain `detail::Circular` buffer, so other processes can
+ * attach a `CircularReader<Record, N_>` to `data()` while the journal is
+ * written (e.g. through their own mapping of the file). How often the dirty
+ * pages are flushed with `msync` is set by `JournalOptions`; flushing is
+ * synchronous, so the writer blocks for the duration of the disk write.
+ *
+ * **Recovery**: when an existing file with the same @p key is opened, every
+ * slot is checked and the records with a valid checksum and a sequence
+ * matching their slot are kept, up to `N_` records before the most recent one.
+ * They are available, oldest first, from `recovered()`; the slots of that
+ * window whose record was not flushed completely are counted by `lost()`.
+ * The heads are then checked against the recovered records and reset if the
+ * crash left them inconsistent, so that writing resumes after the last intact
+ * record. Files with another key are reset to an empty journal.
+ *
+ * **Thread / process safety**: one writer, as for `CircularWriter`.
+ *
+ * @tparam TYPE_ Element type of the journal; must be trivially copyable.
+ * @tparam N_    Capacity in number of records.
+ *
+ * @see CircularWriter
+ */
+template <typename TYPE_, size_t N_>
+class Journal final {
+public:
+    using Record = JournalRecord<TYPE_>;
+    using Writer = CircularWriter<Record, N_>;
+    using Reader = CircularReader<Record, N_>;
+
+    static_assert(std::is_trivially_copyable_v<TYPE_>);
+
+    /**
+     * Opens the journal file @p path, creating it if needed, maps it and
+     * recovers its records.
+     *
+     * @param path    Path of the file.
+     * @param key     Unique identifier for this journal; a file initialised
+     *                with another key is reset.
+     * @param options When the records are flushed to the file.
+     * @throws std::system_error if the file cannot be opened, resized or mapped.
+     */
+    Journal(std::string path, const uint64_t key, const JournalOptions options = {})
+          : path_(std::move(path)),
+            options_(options),
+            fd_(open_file(path_)),
+            memory_(map_file(fd_, path_)),
+            recovered_(recover(key)),
+            writer_(data(), key),
+            last_sync_(std::chrono::steady_clock::now()) {}
+
+    /** Flushes the pending records unless the policy is `JournalSync::NEVER`. */
+    ~Journal() noexcept {
+        if (options_.sync != JournalSync::NEVER) {
+            try {
+                sync();
+            } catch (const std::system_error&) {
+                // nothing sensible to do in a destructor
+            }
+        }
+        ::munmap(memory_, SIZE);
+        ::close(fd_);
+    }
+
+    // no copies no moves
+    Journal(const Journal& other) = delete;
+    Journal& operator=(const Journal& other) = delete;
+    Journal(Journal&& other) = delete;
+    Journal& operator=(Journal&& other) = delete;
+
+    /**
+     * Appends @p value to the journal, overwriting the oldest record if it is
+     * full, and flushes it if the sync policy asks for it.
+     * @throws std::system_error if the flush fails.
+     */
+    void write(const TYPE_& value) {
+        // built in place so that the checksum covers the bytes that are persisted
+        auto& record = writer_.claim();
+        record.sequence = next_;
+        record.value = value;
+        record.crc = record.checksum();
+        writer_.commit();
+        ++next_;
+        ++unsynced_;
+
+        switch (options_.sync) {
+            case JournalSync::NEVER:
+                break;
+            case JournalSync::EVERY:
+                if (unsynced_ >= options_.every) {
+                    sync();
+                }
+                break;
+            case JournalSync::PERIODIC:
+                if (std::chrono::steady_clock::now() - last_sync_ >= options_.period) {
+                    sync();
+                }
+                break;
+        }
+    }
+
+    /**
+     * Flushes the records written since the last flush, then the heads, and
+     * waits for the disk writes to complete.
+     * @throws std::system_error if `msync` fails.
+     */
+    void sync() {
+        last_sync_ = std::chrono::steady_clock::now();
+        if (unsynced_ == 0) {
+            return;
+        }
+        auto& buffer_data = this->buffer_data();
+        const auto count = std::min<uint64_t>(unsynced_, N_);
+        const auto first = (next_ - count) % N_;
+        const auto before_wrap = std::min<uint64_t>(count, N_ - first);
+        sync_range(&buffer_data.data[first], before_wrap * sizeof(Record));
+        sync_range(&buffer_data.data[0], (count - before_wrap) * sizeof(Record));
+        constexpr auto HEADS = offsetof(BufferDataT, write_head);
+        sync_range(&buffer_data.write_head, sizeof(BufferDataT) - HEADS);
+        unsynced_ = 0;
+    }
+
+    /** Returns the records that survived from the previous use of the file, oldest first. */
+    const std::vector<TYPE_>& recovered() const noexcept { return recovered_; }
+
+    /**
+     * Returns the number of records that were lost from the previous use of
+     * the file: slots within the last `N_` positions whose record was missing
+     * or corrupted.
+     */
+    std::size_t lost() const noexcept { return lost_; }
+
+    /** Returns the mapped buffer, e.g. to attach a `Reader` with the journal's key. */
+    uint8_t* data() const noexcept { return static_cast<uint8_t*>(memory_); }
+
+    /** Returns the path of the file. */
+    const std::string& path() const noexcept { return path_; }
+
+private:
+    using BufferDataT = detail::BufferData<Record, N_>;
+
+    /** Size of the file and of the mapping. */
+    constexpr static std::size_t SIZE = Writer::MIN_BUFFER_SIZE;
+
+    const std::string path_;
+    const JournalOptions options_;
+    const int fd_;
+    void* const memory_;
+    std::size_t lost_ = 0;
+    const std::vector<TYPE_> recovered_;
+    Writer writer_;
+    uint64_t next_ = position(load_write_head());
+    uint64_t unsynced_ = 0;
+    std::chrono::steady_clock::time_point last_sync_;
+
+    BufferDataT& buffer_data() const noexcept {
+        return *reinterpret_cast<BufferDataT*>(Writer::aligned_in_buffer(memory_));
+    }
+
+    detail::Head load_write_head() const noexcept {
+        return detail::load_head(buffer_data().write_head, std::memory_order_relaxed);
+    }
+
+    static uint64_t position(const detail::Head& head) noexcept {
+        return uint64_t(head.lap) * N_ + head.index;
+    }
+
+    static detail::Head head(const uint64_t position) noexcept {
+        return { .index = uint32_t(position % N_), .lap = uint32_t(position / N_) };
+    }
+
+    [[noreturn]] static void throw_error(const char* what, const std::string& path) {
+        throw std::system_error(errno, std::generic_category(), std::string(what) + " " + path);
+    }
+
+    static int open_file(const std::string& path) {
+        const auto fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd == -1) {
+            throw_error("open", path);
+        }
+        return fd;
+    }
+
+    /** Grows the file behind @p fd to `SIZE` if needed and maps it; closes @p fd on failure. */
+    static void* map_file(const int fd, const std::string& path) {
+        struct stat status;
+        if (::fstat(fd, &status) != 0
+            || (std::size_t(status.st_size) < SIZE && ::ftruncate(fd, off_t(SIZE)) != 0)) {
+            const auto error = errno;
+            ::close(fd);
+            errno = error;
+            throw_error("resize", path);
+        }
+        auto memory = ::mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (memory == MAP_FAILED) {
+            const auto error = errno;
+            ::close(fd);
+            errno = error;
+            throw_error("mmap", path);
+        }
+        return memory;
+    }
+
+    /** Calls `msync` on the pages spanning the @p size bytes from @p begin. */
+    void sync_range(const void* begin, const std::size_t size) const {
+        if (size == 0) {
+            return;
+        }
+        static const auto page_size = std::size_t(::sysconf(_SC_PAGESIZE));
+        const auto address = reinterpret_cast<std::uintptr_t>(begin);
+        const auto page = address / page_size * page_size;
+        if (::msync(reinterpret_cast<void*>(page), address - page + size, MS_SYNC) != 0) {
+            throw_error("msync", path_);
+        }
+    }
+
+    /**
+     * Collects the intact records of a file written with @p key and makes the
+     * heads consistent with them, before `writer_` validates the buffer.
+     * @return the recovered values, oldest first.
+     */
+    std::vector<TYPE_> recover(const uint64_t key) {
+        auto& buffer_data = this->buffer_data();
+        // the key is written once when the file is created, so a mismatch
+        // means a new file or the file of another journal
+        if (buffer_data.key != key || buffer_data.crc != detail::crc32(key)) {
+            return {};
+        }
+        const auto is_intact = [](const Record& record, const uint64_t slot) {
+            return record.is_valid() && record.sequence % N_ == slot;
+        };
+        uint64_t next = 0;
+        for (uint64_t slot = 0; slot < N_; ++slot) {
+            const auto& record = buffer_data.data[slot];
+            if (is_intact(record, slot)) {
+                next = std::max(next, record.sequence + 1);
+            }
+        }
+
+        std::vector<TYPE_> values;
+        const auto first = next > N_ ? next - N_ : 0;
+        for (auto sequence = first; sequence < next; ++sequence) {
+            const auto& record = buffer_data.data[sequence % N_];
+            if (is_intact(record, sequence % N_) && record.sequence == sequence) {
+                values.push_back(record.value);
+            } else {
+                ++lost_;
+            }
+        }
+
+        // the heads may have been flushed before or after the records
+        const auto write_head = load_write_head();
+        const auto read_head = detail::load_head(buffer_data.read_head, std::memory_order_relaxed);
+        const auto read = position(read_head);
+        if (position(write_head) != next || read_head.index >= N_ || read < first || read > next) {
+            detail::store_head(buffer_data.write_head, head(next), std::memory_order_relaxed);
+            detail::store_head(buffer_data.read_head, head(next), std::memory_order_relaxed);
+        }
+        // no write is in progress any more
+        detail::store_head(buffer_data.claim_head, head(next), std::memory_order_relaxed);
+        return values;
+    }
+};
+} // namespace brasa::buffer
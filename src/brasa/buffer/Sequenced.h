@@ -0,0 +1,254 @@
+#pragma once
+
+/**
+ * @file
+ * A bounded circular buffer of capacity @p N_ that supports any number of
+ * concurrent writers and readers. Like @p Circular, it stores elements of type
+ * @p TYPE_ in a flat block that lives in caller-supplied memory (e.g. shared
+ * memory) and is identified by a @p key / CRC pair.
+ *
+ * Every slot carries a sequence number that tells whether it is ready to be
+ * written or read for a given position (D. Vyukov's bounded MPMC queue). A
+ * writer or reader claims a position with a single compare-and-swap on the
+ * shared head and then synchronises with its peers only through the slot's
+ * sequence, so contention is limited to that compare-and-swap.
+ */
+
+#include <brasa/buffer/CRC.h>
+#include <brasa/buffer/Circular.h>
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace brasa::buffer::detail {
+
+/**
+ * One element of the @p SequencedBufferData ring.
+ * @tparam TYPE_ Element type stored in the buffer.
+ */
+template <typename TYPE_>
+struct SequencedSlot final {
+    uint64_t sequence; ///< Position the slot is ready for (see @p Sequenced).
+    TYPE_ value;       ///< Stored element.
+};
+
+/**
+ * Raw memory layout of the multi-producer circular buffer.
+ * Positions are 64-bit counters that never wrap in practice; the slot of a
+ * position is `position % N_`. The two heads live on their own cache lines
+ * since every writer updates @p write_position and every reader updates
+ * @p read_position.
+ * @tparam TYPE_ Element type stored in the buffer.
+ * @tparam N_    Capacity in number of elements.
+ */
+template <typename TYPE_, uint32_t N_>
+struct SequencedBufferData final {
+    alignas(CACHE_LINE_SIZE) SequencedSlot<TYPE_> slots[N_]; ///< Ring of stored elements.
+    alignas(CACHE_LINE_SIZE) uint64_t write_position;        ///< Next position to write.
+    alignas(CACHE_LINE_SIZE) uint64_t read_position;         ///< Next position to read.
+    alignas(CACHE_LINE_SIZE) uint64_t key; ///< Unique identifier of the buffer.
+    uint32_t crc;                          ///< CRC-32 of @p key.
+};
+
+/**
+ * Base class for the multi-producer / multi-consumer circular buffer. Provides
+ * the core read/write logic and buffer-initialisation bookkeeping. Intended to
+ * be used only through the @p SequencedWriter and @p SequencedReader
+ * subclasses.
+ *
+ * Slot `position % N_` holds `sequence == position` when it is free for the
+ * writer of `position`, and `sequence == position + 1` once that writer has
+ * filled it. The reader of `position` then sets it to `position + N_`, making
+ * it free for the writer of the next lap.
+ *
+ * **Thread / process safety:** any number of writers and readers, in any
+ * number of threads or processes, may use the buffer concurrently. Each
+ * element is read exactly once.
+ *
+ * **Full buffer:** unlike @p Circular, the writer cannot overwrite unread
+ * elements, since a reader may be copying them. Writing into a full buffer
+ * fails instead.
+ *
+ * **Crashes:** a writer or reader that dies between claiming a position and
+ * storing the slot's sequence leaves that slot behind for good: its peers
+ * stop at that position, and views attached later with the same key keep
+ * the stuck buffer, since only the key, CRC and positions are checked. The
+ * sequences are not checked because a live peer's operation in flight looks
+ * the same, and resetting the buffer under it would corrupt it. Recover by
+ * attaching with a new key once no process uses the buffer any more.
+ *
+ * @tparam TYPE_ Element type. Must be trivially copyable.
+ * @tparam N_    Capacity (number of elements). Must be a power of two.
+ */
+template <typename TYPE_, uint32_t N_>
+class Sequenced {
+protected: // to allow testing and prevent use outside of the classes
+    using BufferDataT = SequencedBufferData<TYPE_, N_>;
+
+public:
+    static_assert(N_ >= 2);
+    static_assert(std::has_single_bit(N_), "N_ must be a power of two");
+    static_assert(std::is_trivially_copyable_v<TYPE_>);
+    static_assert(std::is_standard_layout_v<BufferDataT>);
+    static_assert(std::is_trivially_copyable_v<BufferDataT>);
+    static_assert(std::atomic_ref<uint64_t>::is_always_lock_free);
+
+    using TYPE = TYPE_;
+    /** Buffer capacity (number of elements). */
+    constexpr static uint32_t N = N_;
+    /** Required size of the raw byte buffer. */
+    constexpr static std::size_t BUFFER_SIZE = sizeof(BufferDataT);
+    static constexpr std::size_t MIN_BUFFER_SIZE = BUFFER_SIZE + alignof(BufferDataT) - 1;
+
+    // no copies no moves
+    Sequenced(const Sequenced& other) = delete;
+    Sequenced& operator=(const Sequenced& other) = delete;
+    Sequenced(Sequenced&& other) = delete;
+    Sequenced& operator=(Sequenced&& other) = delete;
+
+    /**
+     * Returns the aligned pointer within the provided buffer.
+     *
+     * @param buffer Pointer to the raw memory buffer.
+     * @return uint8_t* First aligned pointer within the buffer.
+     */
+    static uint8_t* aligned_in_buffer(void* buffer) {
+        std::size_t space = MIN_BUFFER_SIZE;
+        std::align(alignof(BufferDataT), BUFFER_SIZE, buffer, space);
+        return static_cast<uint8_t*>(buffer);
+    }
+
+protected:
+    /**
+     * Constructs the buffer view over an existing byte buffer. If the buffer is
+     * not yet initialised (key/CRC mismatch or invalid positions), it is reset
+     * to an empty state.
+     * @attention Resetting is not synchronised with concurrent users, so the
+     * first view over a new buffer must be created before sharing it.
+     *
+     * @param buffer Pointer to raw memory of at least @p MIN_BUFFER_SIZE bytes.
+     * @param key    Unique identifier for this buffer; used to detect whether
+     *               the buffer has already been initialised.
+     */
+    Sequenced(uint8_t* buffer, const uint64_t key) : Sequenced(buffer, key, crc32(key)) {}
+
+    /**
+     * Same as `Sequenced(uint8_t*, uint64_t)` for a key known at compile time,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    Sequenced(uint8_t* buffer, const Key<KEY_> key) : Sequenced(buffer, key.value, key.crc) {}
+
+    ~Sequenced() noexcept = default;
+
+    /**
+     * Stores @p value in the next free slot.
+     * @param value Element to store.
+     * @return @c false (and nothing is written) if the buffer is full.
+     */
+    bool do_write(const TYPE& value) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        std::atomic_ref<uint64_t> write_position(buffer_data->write_position);
+        auto position = write_position.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& slot = buffer_data->slots[position % N_];
+            const auto sequence = load_sequence(slot);
+            const auto lag = int64_t(sequence - position);
+            if (lag == 0) {
+                if (write_position.compare_exchange_weak(
+                          position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    store_sequence(slot, position + 1);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false; // the slot still holds the element written one lap ago
+            } else {
+                position = write_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Reads the oldest element into @p value.
+     * @param[out] value Receives the element on success.
+     * @return @c true if an element was read; @c false if the buffer is empty.
+     */
+    bool do_read(TYPE& value) noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        std::atomic_ref<uint64_t> read_position(buffer_data->read_position);
+        auto position = read_position.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& slot = buffer_data->slots[position % N_];
+            const auto sequence = load_sequence(slot);
+            const auto lag = int64_t(sequence - (position + 1));
+            if (lag == 0) {
+                if (read_position.compare_exchange_weak(
+                          position, position + 1, std::memory_order_relaxed)) {
+                    value = slot.value;
+                    store_sequence(slot, position + N_);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false; // the slot has not been written yet
+            } else {
+                position = read_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    /** Constructs the view for @p key, whose CRC-32 is @p crc. */
+    Sequenced(uint8_t* buffer, const uint64_t key, const uint32_t crc)
+          : buffer_(aligned_in_buffer(buffer)),
+            key_(key),
+            crc_(crc) {
+        if (not is_initialized()) {
+            initialize();
+        }
+    }
+
+    uint8_t* buffer_;
+    const uint64_t key_;
+    const uint32_t crc_;
+
+    static uint64_t load_sequence(SequencedSlot<TYPE>& slot) noexcept {
+        return std::atomic_ref<uint64_t>(slot.sequence).load(std::memory_order_acquire);
+    }
+
+    static void store_sequence(SequencedSlot<TYPE>& slot, const uint64_t sequence) noexcept {
+        std::atomic_ref<uint64_t>(slot.sequence).store(sequence, std::memory_order_release);
+    }
+
+    /**
+     * Returns @c true if the buffer's key, CRC, and positions are all
+     * consistent with this instance. The slot sequences are not checked:
+     * see the crashes note of the class.
+     */
+    [[nodiscard]] bool is_initialized() const noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        const auto read_position = std::atomic_ref<uint64_t>(buffer_data->read_position).load(
+              std::memory_order_acquire);
+        const auto write_position = std::atomic_ref<uint64_t>(buffer_data->write_position).load(
+              std::memory_order_acquire);
+        return read_position <= write_position && write_position - read_position <= N_
+               && buffer_data->key == key_ && buffer_data->crc == crc_;
+    }
+
+    /** Resets the buffer to an empty state and stamps it with @p key_ and @p crc_. */
+    void initialize() noexcept {
+        auto buffer_data = reinterpret_cast<BufferDataT*>(buffer_);
+        for (uint32_t i = 0; i < N_; ++i) {
+            buffer_data->slots[i].sequence = i;
+        }
+        buffer_data->write_position = 0;
+        buffer_data->read_position = 0;
+        buffer_data->key = key_;
+        buffer_data->crc = crc_;
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+};
+} // namespace brasa::buffer::detail
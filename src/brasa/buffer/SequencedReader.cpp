@@ -0,0 +1 @@
+#include <brasa/buffer/SequencedReader.h>
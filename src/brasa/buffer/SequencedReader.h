@@ -0,0 +1,58 @@
+#pragma once
+
+#include <brasa/buffer/Sequenced.h>
+
+namespace brasa::buffer {
+
+/**
+ * Read-only view over a multi-producer circular buffer stored in
+ * caller-supplied memory.
+ *
+ * Any number of `SequencedReader`s may consume the same buffer concurrently;
+ * each element is delivered to exactly one of them. Elements written by one
+ * writer are read in the order they were written.
+ *
+ * @tparam TYPE_ Element type to read. Must be trivially copyable.
+ * @tparam N_    Buffer capacity in number of elements. Must be a power of two.
+ *
+ * @see SequencedWriter
+ * @see detail::Sequenced
+ */
+template <typename TYPE_, uint32_t N_>
+class SequencedReader : public detail::Sequenced<TYPE_, N_> {
+public:
+    using Base = detail::Sequenced<TYPE_, N_>;
+    using Base::MIN_BUFFER_SIZE;
+    using Base::N;
+    using Base::TYPE;
+
+    /**
+     * Constructs a reader over an existing raw byte buffer.
+     *
+     * If the buffer has not yet been initialised (key/CRC mismatch or invalid
+     * positions), it is reset to an empty state. Otherwise the existing content
+     * is left intact, allowing the reader to resume after a restart. A peer
+     * that died in the middle of an operation leaves the buffer stuck, which
+     * is not detected: use a new key then (see `detail::Sequenced`).
+     *
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    SequencedReader(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
+
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    SequencedReader(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
+    /**
+     * Reads the oldest element into @p value.
+     *
+     * @param[out] value Receives the element on success; unchanged on failure.
+     * @return `true` if an element was read; `false` if the buffer is empty.
+     */
+    bool read(TYPE_& value) noexcept { return Base::do_read(value); }
+};
+} // namespace brasa::buffer
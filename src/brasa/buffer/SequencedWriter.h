@@ -0,0 +1,58 @@
+#pragma once
+
+#include <brasa/buffer/Sequenced.h>
+
+namespace brasa::buffer {
+
+/**
+ * Write-only view over a multi-producer circular buffer stored in
+ * caller-supplied memory.
+ *
+ * Unlike `CircularWriter`, any number of `SequencedWriter`s (and
+ * `SequencedReader`s) may use the same buffer concurrently, from different
+ * threads or processes, without external locking. In exchange the buffer is
+ * bounded: writes fail while it is full instead of overwriting unread data.
+ *
+ * @tparam TYPE_ Element type to write. Must be trivially copyable.
+ * @tparam N_    Buffer capacity in number of elements. Must be a power of two.
+ *
+ * @see SequencedReader
+ * @see detail::Sequenced
+ */
+template <typename TYPE_, uint32_t N_>
+class SequencedWriter : public detail::Sequenced<TYPE_, N_> {
+public:
+    using Base = detail::Sequenced<TYPE_, N_>;
+    using Base::MIN_BUFFER_SIZE;
+    using Base::N;
+    using Base::TYPE;
+
+    /**
+     * Constructs a writer over an existing raw byte buffer.
+     *
+     * If the buffer has not yet been initialised (key/CRC mismatch or invalid
+     * positions), it is reset to an empty state. Otherwise the existing content
+     * is left intact, even if a peer died in the middle of an operation and
+     * left the buffer stuck: use a new key then (see `detail::Sequenced`).
+     *
+     * @param buffer Pointer to raw memory of at least `MIN_BUFFER_SIZE` bytes.
+     * @param key    Unique identifier for this buffer instance.
+     */
+    SequencedWriter(uint8_t* buffer, uint64_t key) : Base(buffer, key) {}
+
+    /**
+     * Same as above for a key known at compile time, e.g. `Key<0x1234>{}`,
+     * whose CRC-32 is computed by the compiler.
+     */
+    template <uint64_t KEY_>
+    SequencedWriter(uint8_t* buffer, Key<KEY_> key) : Base(buffer, key) {}
+
+    /**
+     * Stores @p value in the buffer.
+     *
+     * @param value Element to store.
+     * @return `true` on success; `false` if the buffer is full.
+     */
+    bool write(const TYPE_& value) noexcept { return Base::do_write(value); }
+};
+} // namespace brasa::buffer
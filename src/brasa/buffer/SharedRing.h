@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+ * @file
+ * Owner of a named POSIX shared-memory segment sized and mapped for a
+ * circular buffer, handing out `CircularWriter` / `CircularReader` /
+ * `CircularBroadcastReader` views over it.
+ */
+
+#include <brasa/buffer/CircularBroadcastReader.h>
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace brasa::buffer {
+
+/** How the memory of a `SharedRing` is mapped. */
+struct SharedRingOptions final {
+    /** Pre-fault every page when mapping, so that no write pays a page fault. */
+    bool populate = false;
+    /** Lock the pages in RAM (`mlock`), so that they are never swapped out. */
+    bool lock = false;
+    /**
+     * Ask for transparent huge pages (`madvise(MADV_HUGEPAGE)`) and round the
+     * segment up to a whole number of huge pages. Only effective if the kernel
+     * allows huge pages for shared memory
+     * (`/sys/kernel/mm/transparent_hugepage/shmem_enabled`).
+     */
+    bool huge_pages = false;
+};
+
+/**
+ * RAII owner of a named POSIX shared-memory segment holding a circular buffer.
+ *
+ * The constructor creates the segment if it does not exist (or attaches to it
+ * otherwise), makes it large enough for the buffer and maps it; the destructor
+ * unmaps it. The segment itself outlives the `SharedRing`, so that another
+ * process can attach to it, until `unlink()` removes its name.
+ *
+ * @tparam TYPE_   Element type of the buffer.
+ * @tparam N_      Buffer capacity in number of elements.
+ * @tparam LAYOUT_ Memory layout of the buffer (`detail::BufferData` or
+ *                 `detail::BufferDataPadded`). All users must agree.
+ * @tparam BLOCKING_ Whether the readers can block in `read_wait()`. All users
+ *                   must agree.
+ *
+ * @see CircularWriter
+ * @see CircularReader
+ * @see CircularBroadcastReader
+ */
+template <
+      typename TYPE_,
+      size_t N_,
+      template <typename, uint32_t> typename LAYOUT_ = detail::BufferData,
+      bool BLOCKING_ = false>
+class SharedRing final {
+public:
+    using Writer = CircularWriter<TYPE_, N_, LAYOUT_, BLOCKING_>;
+    using Reader = CircularReader<TYPE_, N_, LAYOUT_, BLOCKING_>;
+    using BroadcastReader = CircularBroadcastReader<TYPE_, N_, LAYOUT_, BLOCKING_>;
+
+    /** Size of the huge pages used when `SharedRingOptions::huge_pages` is set. */
+    constexpr static std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * Creates or attaches to the shared-memory segment @p name and maps it.
+     *
+     * @param name    Name of the segment, as for `shm_open` (e.g. "/my_ring").
+     * @param options How the memory is mapped.
+     * @throws std::system_error if the segment cannot be opened, resized,
+     *         mapped or set up as requested by @p options.
+     */
+    explicit SharedRing(std::string name, const SharedRingOptions options = {})
+          : name_(std::move(name)),
+            size_(options.huge_pages ? round_up(Writer::MIN_BUFFER_SIZE, HUGE_PAGE_SIZE)
+                                     : Writer::MIN_BUFFER_SIZE) {
+        fd_ = ::shm_open(name_.c_str(), O_RDWR | O_CREAT, 0666);
+        if (fd_ == -1) {
+            throw_error("shm_open");
+        }
+        try {
+            map(options);
+        } catch (...) {
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    ~SharedRing() noexcept {
+        ::munmap(memory_, size_);
+        ::close(fd_);
+    }
+
+    // no copies no moves
+    SharedRing(const SharedRing& other) = delete;
+    SharedRing& operator=(const SharedRing& other) = delete;
+    SharedRing(SharedRing&& other) = delete;
+    SharedRing& operator=(SharedRing&& other) = delete;
+
+    /** Returns a writer over the mapped buffer (see `CircularWriter`). */
+    Writer writer(const uint64_t key) { return Writer(data(), key); }
+
+    /** Same as above for a key known at compile time, e.g. `Key<0x1234>{}`. */
+    template <uint64_t KEY_>
+    Writer writer(const Key<KEY_> key) {
+        return Writer(data(), key);
+    }
+
+    /** Returns a reader over the mapped buffer (see `CircularReader`). */
+    Reader reader(const uint64_t key) { return Reader(data(), key); }
+
+    /** Same as above for a key known at compile time, e.g. `Key<0x1234>{}`. */
+    template <uint64_t KEY_>
+    Reader reader(const Key<KEY_> key) {
+        return Reader(data(), key);
+    }
+
+    /** Returns a reader with its own cursor (see `CircularBroadcastReader`). */
+    BroadcastReader broadcast_reader(const uint64_t key) { return BroadcastReader(data(), key); }
+
+    /** Same as above for a key known at compile time, e.g. `Key<0x1234>{}`. */
+    template <uint64_t KEY_>
+    BroadcastReader broadcast_reader(const Key<KEY_> key) {
+        return BroadcastReader(data(), key);
+    }
+
+    /** Returns the mapped memory, of at least `Writer::MIN_BUFFER_SIZE` bytes. */
+    uint8_t* data() const noexcept { return static_cast<uint8_t*>(memory_); }
+
+    /** Returns the size of the mapping in bytes. */
+    std::size_t size() const noexcept { return size_; }
+
+    /** Returns the name of the segment. */
+    const std::string& name() const noexcept { return name_; }
+
+    /**
+     * Removes the name of the segment @p name. Existing mappings stay valid;
+     * the memory is released once the last one is unmapped.
+     * @return `false` if the segment did not exist or could not be removed.
+     */
+    static bool unlink(const std::string& name) noexcept {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+private:
+    const std::string name_;
+    const std::size_t size_;
+    int fd_ = -1;
+    void* memory_ = nullptr;
+
+    constexpr static std::size_t round_up(const std::size_t size, const std::size_t granularity) {
+        return (size + granularity - 1) / granularity * granularity;
+    }
+
+    [[noreturn]] void throw_error(const char* what) const {
+        throw std::system_error(errno, std::generic_category(), std::string(what) + " " + name_);
+    }
+
+    /** Grows the segment to @p size_ if needed and maps it as requested by @p options. */
+    void map(const SharedRingOptions& options) {
+        struct stat status;
+        if (::fstat(fd_, &status) != 0) {
+            throw_error("fstat");
+        }
+        // never shrinks a segment that other processes may have mapped
+        if (std::size_t(status.st_size) < size_ && ::ftruncate(fd_, off_t(size_)) != 0) {
+            throw_error("ftruncate");
+        }
+
+        // huge pages must be requested before the memory is faulted in
+        const int populate = options.populate && not options.huge_pages ? MAP_POPULATE : 0;
+        memory_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | populate, fd_, 0);
+        if (memory_ == MAP_FAILED) {
+            throw_error("mmap");
+        }
+        try {
+            if (options.huge_pages) {
+                if (::madvise(memory_, size_, MADV_HUGEPAGE) != 0) {
+                    throw_error("madvise(MADV_HUGEPAGE)");
+                }
+                if (options.populate && ::madvise(memory_, size_, MADV_POPULATE_WRITE) != 0) {
+                    throw_error("madvise(MADV_POPULATE_WRITE)");
+                }
+            }
+            if (options.lock && ::mlock(memory_, size_) != 0) {
+                throw_error("mlock");
+            }
+        } catch (...) {
+            ::munmap(memory_, size_);
+            throw;
+        }
+    }
+};
+
+/** SharedRing whose readers can block in `read_wait()`; see `BlockingCircularWriter`. */
+template <typename TYPE_, size_t N_>
+using BlockingSharedRing = SharedRing<TYPE_, N_, detail::BufferData, true>;
+} // namespace brasa::buffer
@@ -3,17 +3,72 @@
 #include <brasa/thread/RcuReader.h>
 #include <brasa/thread/RcuWriter.h>
 
-#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <list>
 #include <mutex>
+#include <optional>
+#include <thread>
 
 namespace brasa::thread {
 
+namespace detail {
+/** Cache line size assumed to keep the counters written by different reader threads apart. */
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/** Number of stripes the reader counters of an `Rcu` are split into. */
+constexpr size_t READER_STRIPES = 16;
+
+/**
+ * Returns the stripe of the reader counters used by the calling thread. The threads are given
+ * the stripes in turn, on their first call, so up to `READER_STRIPES` threads never share one.
+ */
+inline size_t reader_stripe() noexcept {
+    static std::atomic<size_t> next_stripe = 0;
+    thread_local const size_t stripe =
+          next_stripe.fetch_add(1, std::memory_order_relaxed) % READER_STRIPES;
+    return stripe;
+}
+
+/** Number of nodes whose references can be counted at the same time in a stripe. */
+constexpr size_t REFERENCES_PER_STRIPE = 3;
+} // namespace detail
+
+/** Which thread reclaims the versions of an `Rcu` value that are no longer used. */
+enum class RcuReclaim {
+    ON_WRITE,  ///< The writer, after publishing a new version.
+    BACKGROUND ///< A thread of the `Rcu` object, every `RcuOptions::period` or after a write.
+};
+
+/** How an `Rcu` object reclaims the versions of its value. */
+struct RcuOptions final {
+    RcuReclaim reclaim = RcuReclaim::ON_WRITE;
+    /** Longest time between two reclamations for `RcuReclaim::BACKGROUND`. */
+    std::chrono::nanoseconds period = std::chrono::milliseconds(10);
+    /**
+     * Number of reclaimed nodes kept for reuse by `write()`; the others are destroyed. Each kept
+     * node holds a full copy of `T` (and the memory it owns), so the memory cost is up to this
+     * many extra copies of the value: raise it only for values that are cheap to keep.
+     */
+    size_t max_free_nodes = 1;
+};
+
 /**
  * Class that implements a user space RCU (https://en.wikipedia.org/wiki/Read-copy-update) of
  * a \b single value of type T. It is important to assure that the lifetime of this object is longer
  * than the lifetime of any `RcuReader` or `RcuWriter` object.
+ *
+ * The nodes of the versions that are no longer used are kept in a free list and reused by the
+ * next writes, which copy-assign the current value into them: `T` must be copy-assignable, and
+ * the memory it owns (e.g. the capacity of a `std::vector`) is reused as well.
+ *
+ * A replaced version is retired when it is published and reclaimed once its last reader is gone,
+ * either by the next writer or by a background thread (see `RcuOptions`). The background thread
+ * takes the destruction of the nodes beyond `RcuOptions::max_free_nodes` off the writer, and
+ * reclaims the versions held by slow readers even if no other write comes.
  */
 template <typename T>
 class Rcu {
@@ -21,30 +76,61 @@ public:
     /**
      * Creates the RCU object with the initial value.
      *
-     * @param t the initial value.
+     * @param t       the initial value.
+     * @param options how the versions no longer used are reclaimed.
      */
-    explicit Rcu(T t);
+    explicit Rcu(T t, RcuOptions options = {});
+    /** Stops the background reclamation, if any. */
+    ~Rcu() noexcept;
+    Rcu(const Rcu&) = delete;
+    Rcu& operator=(const Rcu&) = delete;
+    Rcu(Rcu&&) = delete;
+    Rcu& operator=(Rcu&&) = delete;
     /**
      * Return the number of available objects.
      *
-     * @return the number of nodes currently in the list.
-     * @note Must not be called while a `RcuWriter` is active (i.e., between `write()` and
-     *       the destruction of the returned `RcuWriter`), as `nodes_mutex_` is held during
-     *       that window and `size()` would deadlock.
+     * @return the number of versions alive: the current one, the one being written, if any, and
+     *         the retired ones.
+     * @note A single atomic load: it can be called at any time, even while a `RcuWriter` is
+     *       active.
      */
-    size_t size() const noexcept { return nodes_.size(); }
+    size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+    /**
+     * Return the epoch of the current version: 0 for the initial value, incremented by each
+     * publication. Readers can keep state derived from a version and compare its
+     * `RcuReader::epoch()` with this one to know whether it is outdated.
+     *
+     * @return the epoch of the last version published.
+     * @note It is updated just before the version is published, so a `read()` after it may
+     *       return the version with epoch `current_epoch() - 1`, never an older one.
+     */
+    uint64_t current_epoch() const noexcept { return epoch_.load(std::memory_order_acquire); }
+    /**
+     * Return the number of versions that were replaced but are not reclaimed yet, because a
+     * reader still holds them or because the reclamation has not run since they were released.
+     *
+     * @return the number of retired nodes.
+     */
+    size_t pending_retirements() const noexcept {
+        return pending_retirements_.load(std::memory_order_relaxed);
+    }
     /**
      * Get a read-only reference to the value.
-     * Any number of readers can call this function and the contention is minimal: current_mutex_ is
-     * locked to assure proper reference counting. When the `RcuReader` object is destroyed,
-     * `release()` is called and `current_mutex_` is locked again to assure proper reference
-     * counting.
+     * Any number of readers can call this function concurrently with each other and with a writer:
+     * it never locks, it only loads `current_` and increments the reference count of the current
+     * node, announced in `readers_` for the writer to know when that window is over. When the
+     * `RcuReader` object is destroyed, `release()` is called to decrement the reference count.
+     * The counters are split in stripes of one cache line each, one stripe per thread (up to
+     * `detail::READER_STRIPES` threads), so that readers on different cores do not write to the
+     * same cache line. The reference counts live in the stripes as well, not in the nodes, so a
+     * version only costs its value and a few counters.
      *
      * @return an `RcuReader` holding a read-only reference to the current value.
      */
     RcuReader<T, Rcu<T>> read() const noexcept;
     /**
      * Get a read/write reference to change current value.
+     * The copy is made into a node of the free list, if there is one, to reuse its storage.
      * This function locks nodes_mutex_ and will block all other calls to `write()` until the
      * returned `RcuWriter` object is destroyed and `update()` is called, releasing the lock on
      * `nodes_mutex_`. The caller must ensure that the `RcuWriter` object is eventually destroyed
@@ -53,45 +139,158 @@ public:
      * @return an `RcuWriter` holding a read/write reference to a copy of the current value.
      */
     RcuWriter<T, Rcu<T>> write();
+    /**
+     * Same as `write()`, but does not wait if another `RcuWriter` is active.
+     *
+     * @return an `RcuWriter` as `write()`, or `std::nullopt` if `nodes_mutex_` is locked.
+     */
+    std::optional<RcuWriter<T, Rcu<T>>> try_write();
+    /**
+     * Same as `write()`, but waits at most @p timeout for the other `RcuWriter` to finish.
+     *
+     * @param timeout the longest time to wait for `nodes_mutex_`.
+     * @return an `RcuWriter` as `write()`, or `std::nullopt` if `nodes_mutex_` stayed locked.
+     */
+    template <typename REP, typename PERIOD>
+    std::optional<RcuWriter<T, Rcu<T>>> write_for(std::chrono::duration<REP, PERIOD> timeout);
 
 private:
-    /** The values are stored in this ref-counted structure. */
+    struct Node;
+
+public:
+    /** Handle given to each `RcuReader` to release its node directly. */
+    using Handle = const Node*;
+
+private:
+    /**
+     * The values are stored in this ref-counted structure. Its references are counted in the
+     * stripes of `readers_`, and only in `overflow_` when the stripe has no room for the node.
+     */
     struct Node {
         /**
          * Creates a new node with the initial value, and ref-count set to 0.
          *
          * @param value the initial value.
          */
-        explicit Node(T value) noexcept : refcount_(0), value_(std::move(value)) {}
-        mutable std::atomic<int> refcount_; ///< number of readers.
-        T value_;                           ///< the value.
+        explicit Node(T value) noexcept : value_(std::move(value)) {}
+        T value_;                                 ///< the value.
+        uint64_t epoch_ = 0;                      ///< the epoch of the version, set when published.
+        mutable std::atomic<int64_t> overflow_{}; ///< references not counted in a stripe.
+    };
+
+    /** References to a node taken minus those released by the threads of a stripe. */
+    struct Reference final {
+        std::atomic<const Node*> node = nullptr; ///< the node, or null if the entry is free.
+        std::atomic<int64_t> count = 0;          ///< the number of references.
     };
 
-    mutable std::mutex nodes_mutex_;   ///< mutex to protect the nodes list (write mutex).
-    std::list<Node> nodes_;            ///< list of nodes with different versions of the value.
-    mutable std::mutex current_mutex_; ///< mutex to protect the current node (read mutex).
-    const Node* current_;              ///< pointer to the current node (the last one in the list).
+    /**
+     * Counters of the readers of a stripe that are taking a reference, for each phase, and
+     * reference counts of the nodes they hold, all in one cache line.
+     */
+    struct alignas(detail::CACHE_LINE_SIZE) ReaderStripe final {
+        std::array<std::atomic<uint64_t>, 2> readers{}; ///< the counters, indexed by phase.
+        std::array<Reference, detail::REFERENCES_PER_STRIPE> references{}; ///< nodes held.
+    };
+    static_assert(sizeof(ReaderStripe) == detail::CACHE_LINE_SIZE);
+
+    const RcuOptions options_;     ///< how the nodes are reclaimed.
+    std::timed_mutex nodes_mutex_; ///< mutex to protect the nodes list (write mutex).
+    std::list<Node> nodes_;        ///< the current node and the one being written, if any.
+    std::mutex retired_mutex_;     ///< mutex to protect `retired_` and `free_`.
+    std::list<Node> retired_;      ///< nodes replaced, maybe still read.
+    std::list<Node> free_;         ///< nodes no longer used, reused by `write()`.
+    std::atomic<size_t> pending_retirements_ = 0; ///< the size of `retired_`.
+    std::atomic<size_t> size_ = 1;                ///< the size of `nodes_` and `retired_`.
+    std::atomic<uint64_t> epoch_ = 0;             ///< the epoch of the last version published.
+    std::mutex reclaimer_mutex_;                  ///< mutex to protect `stop_`.
+    std::condition_variable reclaimer_cv_; ///< wakes the reclaimer up after a write or a stop.
+    bool stop_ = false;                    ///< whether the reclaimer has to stop.
+    std::thread reclaimer_;                ///< the background reclaimer, if any.
+    /**
+     * Pointer to the current node (the last one in the list). It shares its cache line only with
+     * `phase_`: every reader loads both, and only writers change them.
+     */
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<const Node*> current_;
+    std::atomic<uint64_t> phase_ = 0; ///< selects the counter of `readers_` for new readers.
+    /**
+     * Counters of the readers between loading `current_` and incrementing the reference count of
+     * the node, for each stripe and each of the two phases. Readers use the counter of the
+     * current `phase_` in their stripe; a writer switches the phase and waits for the counters of
+     * the previous one to drop to zero, twice, after which every reader either holds a reference
+     * or will see the new `current_`. As in SRCU, new readers use the other counters, so they
+     * cannot delay the writer forever. Each stripe also holds the reference counts of the nodes
+     * read by its threads (see `ReaderStripe`).
+     */
+    mutable std::array<ReaderStripe, detail::READER_STRIPES> readers_{};
 
     /**
-     * Function that is called when the `RcuReader` object is destroyed.
+     * Function that is called when the `RcuReader` object is destroyed: a single decrement of
+     * the ref-count of the node, which does not touch `nodes_`.
      *
-     * @param t the pointer to the value so it can be found to decrease the ref-count.
+     * @param node the node of the value read.
      */
-    void release(const T* t) const noexcept;
-    friend class RcuReader<T, Rcu<T>>; ///< It is a friend so it can call `release()`.
+    void release(Handle node) const noexcept;
+    /**
+     * Adds @p delta to the references to @p node in @p stripe: in the entry of the node, or in a
+     * free entry that it claims, or in `Node::overflow_` if the stripe has no room.
+     *
+     * @param stripe the stripe of the calling thread.
+     * @param node   the node referenced.
+     * @param delta  +1 to take a reference, -1 to release it.
+     * @param order  the memory order of the update.
+     */
+    void count_reference(size_t stripe, const Node* node, int64_t delta, std::memory_order order)
+          const noexcept;
+    /**
+     * Returns whether @p node has no readers and, if so, frees its entries in the stripes. The
+     * count is only exact once no reader can take a new reference: a reader may release the node
+     * from another stripe than the one it took it from, and the stripes are loaded one after the
+     * other.
+     *
+     * @param node a retired node.
+     * @return true if the sum of the references to @p node is zero.
+     */
+    bool forget_if_unread(const Node& node) noexcept;
+    /**
+     * Function that is called by `RcuReader::epoch()`.
+     *
+     * @param node the node of the value read.
+     * @return the epoch of the version in @p node.
+     */
+    static uint64_t epoch(Handle node) noexcept { return node->epoch_; }
+    friend class RcuReader<T, Rcu<T>>; ///< It is a friend so it can call `release()` and `epoch()`.
 
     /**
      * Function that is called when the `RcuWriter` object is destroyed.
-     * It also performs the cleanup of the nodes that are not being used anymore.
-     * Note that this cleanup has to lock `current_mutex_` once to set `current_` to point to the
-     * new value. Then it removes unused nodes (refcount == 0). Safe traversal without additional
-     * locking because `std::list` erasure does not invalidate other iterators, and any node still
-     * referenced has a positive refcount so it won't be erased concurrently.
+     * It publishes the new value in `current_` and waits for the readers that may still be
+     * taking a reference to an older node (see `readers_`). Then it retires the previous node:
+     * no new reader can reach it any more. Readers release their node through its handle, so they
+     * never walk the lists.
      *
-     * @note `nodes_mutex_` is acquired in `write()` and released at the end of this function.
+     * @note `nodes_mutex_` is acquired in `write()` and released by this function, before the
+     *       reclamation.
      */
     void update() noexcept;
     friend class RcuWriter<T, Rcu<T>>; ///< It is a friend so it can call `update()`.
+
+    /**
+     * Copies the current value into a new node for an `RcuWriter`.
+     *
+     * @note `nodes_mutex_` must be held; it is released if the copy throws.
+     */
+    RcuWriter<T, Rcu<T>> copy_current();
+
+    /**
+     * Moves the retired nodes that are no longer referenced (refcount == 0) to the free list, or
+     * to @p garbage if it is full, for the caller to destroy them once it releases the lock.
+     *
+     * @param garbage the list that receives the nodes to destroy.
+     * @note `retired_mutex_` must be held.
+     */
+    void reclaim(std::list<Node>& garbage) noexcept;
+    /** Body of the background reclaimer. */
+    void run_reclaimer() noexcept;
 };
 
 //-------------------------------------------------------------
@@ -99,34 +298,139 @@ private:
 //-------------------------------------------------------------
 
 template <typename T>
-Rcu<T>::Rcu(T t) {
+Rcu<T>::Rcu(T t, const RcuOptions options) : options_(options) {
     nodes_.emplace_back(std::move(t));
     current_ = &nodes_.back();
+    if (options_.reclaim == RcuReclaim::BACKGROUND) {
+        reclaimer_ = std::thread([this] { run_reclaimer(); });
+    }
+}
+
+template <typename T>
+Rcu<T>::~Rcu() noexcept {
+    if (reclaimer_.joinable()) {
+        { // scope to stop the reclaimer
+            std::lock_guard lock(reclaimer_mutex_);
+            stop_ = true;
+        }
+        reclaimer_cv_.notify_one();
+        reclaimer_.join();
+    }
 }
 
 template <typename T>
 RcuReader<T, Rcu<T>> Rcu<T>::read() const noexcept {
-    std::lock_guard lock(current_mutex_);
-    current_->refcount_ += 1;
-    return RcuReader<T, Rcu<T>>(&current_->value_, this);
+    const auto stripe = detail::reader_stripe();
+    // sequentially consistent, so that a writer that finds the counter at zero has published
+    // `current_` before this reader loads it
+    auto& readers = readers_[stripe].readers[phase_.load() % 2];
+    readers.fetch_add(1);
+    const auto* node = current_.load();
+    count_reference(stripe, node, 1, std::memory_order_relaxed);
+    readers.fetch_sub(1, std::memory_order_release);
+    return RcuReader<T, Rcu<T>>(&node->value_, node, this);
 }
 
 template <typename T>
-void Rcu<T>::release(const T* t) const noexcept {
-    auto it = std::find_if(nodes_.begin(), nodes_.end(), [t](const Node& node) {
-        return &node.value_ == t;
-    });
-    if (it != nodes_.end()) {
-        it->refcount_.fetch_sub(1);
+void Rcu<T>::release(const Handle node) const noexcept {
+    // release, so that the writer that sees the count at zero sees the end of the reads
+    count_reference(detail::reader_stripe(), node, -1, std::memory_order_release);
+}
+
+template <typename T>
+void Rcu<T>::count_reference(
+      const size_t stripe,
+      const Node* node,
+      const int64_t delta,
+      const std::memory_order order) const noexcept {
+    auto& references = readers_[stripe].references;
+    // the entries of a node are only freed once it has no readers, so they cannot change under us
+    for (auto& reference : references) {
+        if (reference.node.load(std::memory_order_relaxed) == node) {
+            reference.count.fetch_add(delta, order);
+            return;
+        }
+    }
+    for (auto& reference : references) {
+        const Node* expected = nullptr;
+        if (reference.node.load(std::memory_order_relaxed) == nullptr
+            && reference.node.compare_exchange_strong(
+                  expected, node, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            reference.count.fetch_add(delta, order);
+            return;
+        }
     }
+    node->overflow_.fetch_add(delta, order);
+}
+
+template <typename T>
+bool Rcu<T>::forget_if_unread(const Node& node) noexcept {
+    std::array<Reference*, detail::READER_STRIPES * detail::REFERENCES_PER_STRIPE> entries;
+    size_t size = 0;
+    int64_t readers = node.overflow_.load(std::memory_order_acquire);
+    for (auto& stripe : readers_) {
+        for (auto& reference : stripe.references) {
+            if (reference.node.load(std::memory_order_acquire) == &node) {
+                readers += reference.count.load(std::memory_order_acquire);
+                entries[size++] = &reference;
+            }
+        }
+    }
+    if (readers != 0) {
+        return false;
+    }
+    node.overflow_.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < size; ++i) {
+        // the count is reset before the entry is freed for another node
+        entries[i]->count.store(0, std::memory_order_relaxed);
+        entries[i]->node.store(nullptr, std::memory_order_release);
+    }
+    return true;
 }
 
 template <typename T>
 RcuWriter<T, Rcu<T>> Rcu<T>::write() {
     nodes_mutex_.lock();
+    return copy_current();
+}
 
+template <typename T>
+std::optional<RcuWriter<T, Rcu<T>>> Rcu<T>::try_write() {
+    if (not nodes_mutex_.try_lock()) {
+        return std::nullopt;
+    }
+    return copy_current();
+}
+
+template <typename T>
+template <typename REP, typename PERIOD>
+std::optional<RcuWriter<T, Rcu<T>>> Rcu<T>::write_for(
+      const std::chrono::duration<REP, PERIOD> timeout) {
+    if (not nodes_mutex_.try_lock_for(timeout)) {
+        return std::nullopt;
+    }
+    return copy_current();
+}
+
+template <typename T>
+RcuWriter<T, Rcu<T>> Rcu<T>::copy_current() {
     try {
-        nodes_.emplace_back(nodes_.back().value_);
+        const auto& current = nodes_.back();
+        std::list<Node> node;
+        { // scope to take a free node; nodes are moved between the lists without allocation
+            std::lock_guard lock(retired_mutex_);
+            if (not free_.empty()) {
+                node.splice(node.end(), free_, free_.begin());
+            }
+        }
+        if (node.empty()) {
+            nodes_.emplace_back(current.value_);
+        } else {
+            // it has no readers
+            node.front().value_ = current.value_;
+            nodes_.splice(nodes_.end(), node);
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
         return RcuWriter<T, Rcu<T>>(&nodes_.back().value_, this);
     } catch (...) {
         nodes_mutex_.unlock();
@@ -136,21 +440,71 @@ RcuWriter<T, Rcu<T>> Rcu<T>::write() {
 
 template <typename T>
 void Rcu<T>::update() noexcept {
-    { // scope update the current pointer
-        std::lock_guard lock(current_mutex_);
-        current_ = &nodes_.back();
+    // only writers change the epoch, under nodes_mutex_
+    const auto epoch = epoch_.load(std::memory_order_relaxed) + 1;
+    nodes_.back().epoch_ = epoch;
+    epoch_.store(epoch, std::memory_order_release);
+    current_.store(&nodes_.back());
+
+    // wait for the readers that may have loaded a previous value of `current_`: twice, as a
+    // reader may have taken its phase before the previous update and be counted in the other one
+    for (size_t i = 0; i < 2; ++i) {
+        const auto previous = phase_.fetch_add(1) % 2;
+        for (const auto& stripe : readers_) {
+            while (stripe.readers[previous].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
     }
 
-    // remove unreferenced nodes that are not the last one
-    for (auto it = nodes_.begin(); std::next(it) != nodes_.end();) {
-        if (it->refcount_.load() == 0) {
-            it = nodes_.erase(it);
+    std::list<Node> garbage;
+    { // scope to retire the previous node
+        std::lock_guard lock(retired_mutex_);
+        retired_.splice(retired_.end(), nodes_, nodes_.begin(), std::prev(nodes_.end()));
+        if (options_.reclaim == RcuReclaim::ON_WRITE) {
+            reclaim(garbage);
+        }
+        pending_retirements_.store(retired_.size(), std::memory_order_relaxed);
+    }
+    nodes_mutex_.unlock();
+
+    if (options_.reclaim == RcuReclaim::BACKGROUND) {
+        reclaimer_cv_.notify_one();
+    }
+    // the nodes in garbage are destroyed here, without holding the locks
+}
+
+template <typename T>
+void Rcu<T>::reclaim(std::list<Node>& garbage) noexcept {
+    size_t reclaimed = 0;
+    for (auto it = retired_.begin(); it != retired_.end();) {
+        // no reader can take a new reference to a retired node, so its count can only go down
+        if (forget_if_unread(*it)) {
+            auto& target = free_.size() < options_.max_free_nodes ? free_ : garbage;
+            target.splice(target.end(), retired_, it++);
+            ++reclaimed;
         } else {
             ++it;
         }
     }
+    size_.fetch_sub(reclaimed, std::memory_order_relaxed);
+}
 
-    nodes_mutex_.unlock();
+template <typename T>
+void Rcu<T>::run_reclaimer() noexcept {
+    std::unique_lock lock(reclaimer_mutex_);
+    while (not stop_) {
+        reclaimer_cv_.wait_for(lock, options_.period);
+        lock.unlock();
+        std::list<Node> garbage;
+        { // scope to sort the retired nodes out
+            std::lock_guard retired_lock(retired_mutex_);
+            reclaim(garbage);
+            pending_retirements_.store(retired_.size(), std::memory_order_relaxed);
+        }
+        garbage.clear(); // without holding the locks
+        lock.lock();
+    }
 }
 
 } // namespace brasa::thread
@@ -0,0 +1 @@
+#include <brasa/thread/RcuBatch.h>
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <brasa/thread/Rcu.h>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace brasa::thread {
+
+/**
+ * Class that combines the writes of several threads to an `Rcu`: their mutations are queued and
+ * applied in order to a single copy of the value, which is published once per batch instead of
+ * once per mutation.
+ *
+ * A batch is published by `push()` when its oldest mutation has waited for the time window or
+ * when it holds the maximum number of mutations, and by `flush()` / `flush_if_due()` otherwise.
+ * As `push()` only checks the window when it is called, a thread that needs a bounded publication
+ * delay should call `flush_if_due()` periodically.
+ *
+ * `NOW_FUNC` must be a callable with signature `T()` where `T` is an arithmetic type representing
+ * a tick count (e.g. the functions from `brasa/chronus/Now.h`). Each call must return a value
+ * greater than or equal to the previous call.
+ *
+ * Prefer constructing instances through the `make_rcu_batch()` factory to benefit from template
+ * argument deduction. The `Rcu` object must outlive this one.
+ */
+template <typename T, typename NOW_FUNC>
+class RcuBatch {
+public:
+    /** A change to the value. It should not throw: see `flush()`. */
+    using Mutation = std::function<void(T&)>;
+    /** Tick type returned by `NOW_FUNC`. */
+    using TimeT = std::invoke_result_t<NOW_FUNC>;
+
+    /**
+     * Creates the batch for @p rcu.
+     *
+     * @param rcu         the RCU object whose value is changed.
+     * @param now         the function that returns the current time.
+     * @param window      the longest a mutation waits to be published by `push()`, in units of
+     *                    @p now.
+     * @param max_pending the number of queued mutations that triggers a publication.
+     */
+    RcuBatch(
+          Rcu<T>& rcu,
+          NOW_FUNC&& now,
+          const TimeT window,
+          const size_t max_pending = std::numeric_limits<size_t>::max())
+          : rcu_(rcu),
+            now_(std::move(now)),
+            window_(window),
+            max_pending_(max_pending) {}
+    /** Publishes the mutations still queued. */
+    ~RcuBatch() noexcept {
+        try {
+            flush();
+        } catch (...) {
+            // nothing sensible to do in a destructor
+        }
+    }
+    RcuBatch(const RcuBatch&) = delete;
+    RcuBatch& operator=(const RcuBatch&) = delete;
+    RcuBatch(RcuBatch&&) = delete;
+    RcuBatch& operator=(RcuBatch&&) = delete;
+
+    /**
+     * Queues @p mutation and publishes the batch if it is due. Any number of threads can call
+     * this function concurrently.
+     *
+     * @param mutation the change to apply to the value.
+     * @return the number of mutations published (0 if the batch was only queued).
+     */
+    size_t push(Mutation mutation);
+    /**
+     * Applies the queued mutations, in the order they were pushed, to a copy of the current value
+     * and publishes it with a single `Rcu::write()`. If a mutation throws, the mutations applied
+     * before it are published and the following ones are lost.
+     *
+     * @return the number of mutations published.
+     */
+    size_t flush();
+    /**
+     * Publishes the batch if its oldest mutation has waited for the time window.
+     *
+     * @return the number of mutations published.
+     */
+    size_t flush_if_due();
+    /**
+     * Returns the number of mutations waiting to be published.
+     *
+     * @return the number of queued mutations.
+     */
+    size_t pending() const;
+
+private:
+    Rcu<T>& rcu_;                    ///< the RCU object that is written.
+    NOW_FUNC now_;                   ///< the function that returns the current time.
+    const TimeT window_;             ///< the longest a mutation waits in `push()`.
+    const size_t max_pending_;       ///< the number of mutations that triggers a publication.
+    mutable std::mutex queue_mutex_; ///< mutex to protect `queue_` and `oldest_`.
+    std::vector<Mutation> queue_;    ///< the mutations waiting to be published.
+    TimeT oldest_{};                 ///< the time the oldest mutation in `queue_` was pushed.
+    std::mutex flush_mutex_;         ///< mutex that keeps the batches in order.
+    std::vector<Mutation> batch_;    ///< the batch being published (protected by flush_mutex_).
+};
+
+//-------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------
+
+template <typename T, typename NOW_FUNC>
+size_t RcuBatch<T, NOW_FUNC>::push(Mutation mutation) {
+    bool due;
+    { // scope to queue the mutation
+        std::lock_guard lock(queue_mutex_);
+        const auto now = now_();
+        if (queue_.empty()) {
+            oldest_ = now;
+        }
+        queue_.push_back(std::move(mutation));
+        due = queue_.size() >= max_pending_ || now - oldest_ >= window_;
+    }
+    return due ? flush() : 0;
+}
+
+template <typename T, typename NOW_FUNC>
+size_t RcuBatch<T, NOW_FUNC>::flush() {
+    std::lock_guard flush_lock(flush_mutex_);
+    { // scope to take the queued mutations, keeping the capacity of both vectors
+        std::lock_guard lock(queue_mutex_);
+        if (queue_.empty()) {
+            return 0;
+        }
+        batch_.swap(queue_);
+    }
+    const auto count = batch_.size();
+    try {
+        auto writer = rcu_.write();
+        for (auto& mutation : batch_) {
+            mutation(writer.value());
+        }
+    } catch (...) {
+        batch_.clear();
+        throw;
+    }
+    batch_.clear();
+    return count;
+}
+
+template <typename T, typename NOW_FUNC>
+size_t RcuBatch<T, NOW_FUNC>::flush_if_due() {
+    { // scope to check the age of the batch
+        std::lock_guard lock(queue_mutex_);
+        if (queue_.empty() || now_() - oldest_ < window_) {
+            return 0;
+        }
+    }
+    return flush();
+}
+
+template <typename T, typename NOW_FUNC>
+size_t RcuBatch<T, NOW_FUNC>::pending() const {
+    std::lock_guard lock(queue_mutex_);
+    return queue_.size();
+}
+
+/**
+ * Factory function that creates an `RcuBatch` with template argument deduction.
+ *
+ * @param rcu         the RCU object whose value is changed.
+ * @param now         the function that returns the current time.
+ * @param window      the longest a mutation waits to be published by `push()`.
+ * @param max_pending the number of queued mutations that triggers a publication.
+ * @return an `RcuBatch<T, NOW_FUNC>` writing to @p rcu.
+ */
+template <typename T, typename NOW_FUNC>
+RcuBatch<T, NOW_FUNC> make_rcu_batch(
+      Rcu<T>& rcu,
+      NOW_FUNC&& now,
+      const std::invoke_result_t<NOW_FUNC> window,
+      const size_t max_pending = std::numeric_limits<size_t>::max()) {
+    return RcuBatch<T, NOW_FUNC>(rcu, std::forward<NOW_FUNC>(now), window, max_pending);
+}
+
+} // namespace brasa::thread
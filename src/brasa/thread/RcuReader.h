@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace brasa::thread {
 
 /**
@@ -8,14 +10,21 @@ namespace brasa::thread {
 template <typename T, typename POOL>
 class RcuReader {
 public:
+    /** Opaque reference to the storage of the value in the pool, given back to release it. */
+    using Handle = typename POOL::Handle;
+
     /**
      * Creates the RcuReader object with the ref to the current value.
      *
-     * @param t    the pointer to the current value.
-     * @param pool the pointer to the pool that is the owner of the value and will receive it back
-     *             via release.
+     * @param t      the pointer to the current value.
+     * @param handle the handle of the value in the pool, so that releasing it needs no search.
+     * @param pool   the pointer to the pool that is the owner of the value and will receive it
+     *               back via release.
      */
-    RcuReader(const T* t, const POOL* pool) noexcept : value_(t), pool_(pool) {}
+    RcuReader(const T* t, Handle handle, const POOL* pool) noexcept
+          : value_(t),
+            handle_(handle),
+            pool_(pool) {}
     ~RcuReader() noexcept;
     RcuReader(const RcuReader&) = delete;
     RcuReader(RcuReader&&);
@@ -36,9 +45,18 @@ public:
      * @return true if the object holds a valid value, false otherwise.
      */
     bool is_valid() const noexcept { return value_ != nullptr && pool_ != nullptr; }
+    /**
+     * Return the epoch of the version read, which increases with each version published by the
+     * pool.
+     *
+     * @return the epoch of the value.
+     * @warning Calling this on an invalid (moved-from) reader is undefined behavior.
+     */
+    uint64_t epoch() const noexcept { return pool_->epoch(handle_); }
 
 private:
     const T* value_;   ///< the value stored in the pool.
+    Handle handle_;    ///< the handle of the value in the pool.
     const POOL* pool_; ///< the pool that owns the value.
 };
 
@@ -49,12 +67,13 @@ private:
 template <typename T, typename POOL>
 RcuReader<T, POOL>::~RcuReader() noexcept {
     if (value_ != nullptr && pool_ != nullptr) {
-        pool_->release(value_);
+        pool_->release(handle_);
     }
 }
 
 template <typename T, typename POOL>
 RcuReader<T, POOL>::RcuReader(RcuReader&& other) : value_(other.value_),
+                                                   handle_(other.handle_),
                                                    pool_(other.pool_) {
     other.value_ = nullptr;
     other.pool_ = nullptr;
@@ -63,9 +82,10 @@ RcuReader<T, POOL>::RcuReader(RcuReader&& other) : value_(other.value_),
 template <typename T, typename POOL>
 RcuReader<T, POOL>& RcuReader<T, POOL>::operator=(RcuReader&& other) {
     if (value_ != nullptr && pool_ != nullptr) {
-        pool_->release(value_);
+        pool_->release(handle_);
     }
     value_ = other.value_;
+    handle_ = other.handle_;
     pool_ = other.pool_;
     other.value_ = nullptr;
     other.pool_ = nullptr;
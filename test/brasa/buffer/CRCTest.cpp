@@ -2,8 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
+#include <cstring>
 #include <format>
+#include <vector>
 
 namespace brasa::buffer::detail {
 
@@ -39,4 +43,140 @@ TEST(CRCTest, uint64_consistent_with_buffer) {
     }
 }
 
+/**
+ * Every implementation must match the byte-at-a-time reference, for all
+ * lengths around the block sizes and for unaligned starts.
+ */
+TEST(CRCTest, implementations_agree) {
+    std::vector<uint8_t> data(4096 + 16);
+    srand(7);
+    for (auto& byte : data) {
+        byte = uint8_t(rand());
+    }
+    for (size_t offset = 0; offset < 16; offset += 3) {
+        for (size_t len = 0; len + offset <= data.size(); len += len < 300 ? 1 : 61) {
+            SCOPED_TRACE(std::format("offset {} length {}", offset, len));
+            const auto* buffer = data.data() + offset;
+            const auto expected = crc32_bytewise(buffer, len);
+            EXPECT_EQ(crc32_slicing_by_8(buffer, len), expected);
+            if (has_crc32_clmul()) {
+                EXPECT_EQ(crc32_clmul(buffer, len), expected);
+            }
+            EXPECT_EQ(crc32(buffer, len), expected);
+        }
+    }
+}
+
+/** Checksumming in chunks, of any size, must give the checksum of the whole. */
+TEST(CRCTest, accumulator) {
+    std::vector<uint8_t> data(1000);
+    srand(3);
+    for (auto& byte : data) {
+        byte = uint8_t(rand());
+    }
+    const auto expected = crc32(data.data(), data.size());
+    for (size_t chunk : { 1, 7, 64, 200, 1000 }) {
+        SCOPED_TRACE(std::format("chunk {}", chunk));
+        Crc32 crc;
+        for (size_t begin = 0; begin < data.size(); begin += chunk) {
+            crc.update(std::span(data).subspan(begin, std::min(chunk, data.size() - begin)));
+        }
+        EXPECT_EQ(crc.value(), expected);
+    }
+    EXPECT_EQ(Crc32().value(), 0u);
+}
+
+/** Combining the checksums of two parts must give the checksum of the whole. */
+TEST(CRCTest, combine) {
+    std::vector<uint8_t> data(3000);
+    srand(5);
+    for (auto& byte : data) {
+        byte = uint8_t(rand());
+    }
+    const auto expected = crc32(data.data(), data.size());
+    for (size_t split = 0; split <= data.size(); split += split < 20 ? 1 : 331) {
+        SCOPED_TRACE(std::format("split {}", split));
+        const auto crc_a = crc32(data.data(), split);
+        const auto crc_b = crc32(data.data() + split, data.size() - split);
+        EXPECT_EQ(crc32_combine(crc_a, crc_b, data.size() - split), expected);
+    }
+    // lengths beyond 32 bits: (A B) C and A (B C) must agree
+    constexpr uint64_t LEN = uint64_t(3) << 30;
+    const auto crc_a = 0x1234'5678u;
+    const auto crc_b = 0x9abc'def0u;
+    const auto crc_c = 0x0f1e'2d3cu;
+    EXPECT_EQ(
+          crc32_combine(crc32_combine(crc_a, crc_b, LEN), crc_c, LEN),
+          crc32_combine(crc_a, crc32_combine(crc_b, crc_c, LEN), 2 * LEN));
+}
+
+/** Standard CRC-32C test vector: "123456789" must produce 0xe3069283. */
+TEST(CRCTest, crc32c_known_vector) {
+    const uint8_t data[] = "123456789";
+    EXPECT_EQ(crc32c(data, 9), 0xe306'9283u);
+    EXPECT_EQ(crc32c_slicing_by_8(data, 9), 0xe306'9283u);
+    EXPECT_EQ(crc32c(data, 0), 0x0000'0000u);
+}
+
+/**
+ * The CRC-32C implementations must agree, including on buffers long enough
+ * for the interleaved streams of both block sizes, and with the uint64_t
+ * overload.
+ */
+TEST(CRCTest, crc32c_implementations_agree) {
+    std::vector<uint8_t> data(3 * 8192 + 3 * 256 + 64);
+    srand(11);
+    for (auto& byte : data) {
+        byte = uint8_t(rand());
+    }
+    for (size_t offset = 0; offset < 16; offset += 5) {
+        for (size_t len = 0; len + offset <= data.size(); len += len < 300 ? 1 : 127) {
+            SCOPED_TRACE(std::format("offset {} length {}", offset, len));
+            const auto* buffer = data.data() + offset;
+            const auto expected = crc32c_slicing_by_8(buffer, len);
+            if (has_crc32c_sse42()) {
+                EXPECT_EQ(crc32c_sse42(buffer, len), expected);
+            }
+            EXPECT_EQ(crc32c(buffer, len), expected);
+        }
+    }
+    uint64_t value;
+    std::memcpy(&value, data.data(), sizeof(value));
+    EXPECT_EQ(crc32c(value), crc32c(data.data(), sizeof(value)));
+}
+
+namespace {
+constexpr std::array<uint8_t, 9> CHECK = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+} // namespace
+
+/** The generic CRCs must give the "check" values of the catalogue, at compile time too. */
+TEST(CRCTest, generic_check_values) {
+    static_assert(Crc16Arc::checksum(CHECK) == 0xbb3d);
+    static_assert(Crc16IbmSdlc::checksum(CHECK) == 0x906e);
+    static_assert(Crc16Ccitt::checksum(CHECK) == 0x29b1);
+    static_assert(Crc32IsoHdlc::checksum(CHECK) == 0xcbf4'3926);
+    static_assert(Crc32Iscsi::checksum(CHECK) == 0xe306'9283);
+    static_assert(Crc64Xz::checksum(CHECK) == 0x995d'c9bb'df19'39fa);
+    static_assert(Crc64Ecma182::checksum(CHECK) == 0x6c40'df5f'0b49'7347);
+    static_assert(Crc<uint8_t, 0x07, false, 0, 0>::checksum(CHECK) == 0xf4); // CRC-8/SMBUS
+
+    EXPECT_EQ(Crc32IsoHdlc::checksum(CHECK), crc32(CHECK.data(), CHECK.size()));
+    EXPECT_EQ(Crc32Iscsi::checksum(CHECK), crc32c(CHECK.data(), CHECK.size()));
+    Crc64Xz crc;
+    crc.update(std::span(CHECK).first(4)).update(std::span(CHECK).subspan(4));
+    EXPECT_EQ(crc.value(), Crc64Xz::checksum(CHECK));
+}
+
+/** `crc32(uint64_t)` must give the same result at compile time and at run time. */
+TEST(CRCTest, constexpr_key) {
+    constexpr uint64_t KEY = 0x0123'4567'89ab'cdef;
+    constexpr auto KEY_CRC = crc32(KEY);
+    constexpr auto KEY_CRC_C = crc32c(KEY);
+    volatile uint64_t key = KEY;
+    EXPECT_EQ(crc32(key), KEY_CRC);
+    EXPECT_EQ(crc32c(key), KEY_CRC_C);
+    static_assert(Key<KEY>::value == KEY);
+    static_assert(Key<KEY>::crc == KEY_CRC);
+}
+
 } // namespace brasa::buffer::detail
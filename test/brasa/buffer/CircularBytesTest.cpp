@@ -0,0 +1,314 @@
+#include <brasa/buffer/CircularBytes.h>
+#include <brasa/buffer/CircularBytesReader.h>
+#include <brasa/buffer/CircularBytesWriter.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace brasa::buffer::detail {
+
+namespace {
+
+template <typename PARENT>
+class CircularBytesMock : public PARENT {
+public:
+    using PARENT::BufferDataT;
+    using PARENT::PADDING;
+};
+
+std::span<const uint8_t> as_bytes(std::string_view text) {
+    return { reinterpret_cast<const uint8_t*>(text.data()), text.size() };
+}
+
+template <uint32_t N>
+std::string read_string(CircularBytesReader<N>& reader) {
+    std::vector<uint8_t> record(N);
+    size_t size = 0;
+    if (not reader.read(record, size)) {
+        return "<none>";
+    }
+    return std::string(record.begin(), record.begin() + size);
+}
+
+template <uint32_t N>
+typename CircularBytesMock<CircularBytes<N>>::BufferDataT* buffer_data(uint8_t* buffer) {
+    using BufferDataT = typename CircularBytesMock<CircularBytes<N>>::BufferDataT;
+    return reinterpret_cast<BufferDataT*>(CircularBytes<N>::aligned_in_buffer(buffer));
+}
+} // namespace
+
+TEST(CircularBytesTest, record_size) {
+    using Bytes = CircularBytes<64>;
+    EXPECT_EQ(Bytes::record_size(0), 4u);
+    EXPECT_EQ(Bytes::record_size(1), 8u);
+    EXPECT_EQ(Bytes::record_size(4), 8u);
+    EXPECT_EQ(Bytes::record_size(5), 12u);
+    EXPECT_EQ(Bytes::MAX_RECORD_SIZE, 60u);
+}
+
+TEST(CircularBytesTest, create_uninitialized) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto data = buffer_data<64>(buffer);
+
+    const CircularBytesWriter<64> writer(buffer, KEY);
+    EXPECT_EQ(data->read_head.index, 0u);
+    EXPECT_EQ(data->read_head.lap, 0u);
+    EXPECT_EQ(data->write_head.index, 0u);
+    EXPECT_EQ(data->write_head.lap, 0u);
+    EXPECT_EQ(data->key, KEY);
+    EXPECT_EQ(data->crc, crc32(KEY));
+}
+
+TEST(CircularBytesTest, create_initialized) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<64>(buffer);
+
+    { // scope for the first writer
+        CircularBytesWriter<64> writer(buffer, KEY);
+        EXPECT_TRUE(writer.write(as_bytes("hello")));
+    }
+    CircularBytesReader<64> reader(buffer, KEY);
+    EXPECT_EQ(data->write_head.index, 12u);
+    EXPECT_EQ(read_string(reader), "hello");
+
+    // misaligned heads are not valid
+    data->write_head.index = 13;
+    CircularBytesReader<64> reader2(buffer, KEY);
+    EXPECT_EQ(data->write_head.index, 0u);
+}
+
+TEST(CircularBytesTest, compile_time_key) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto data = buffer_data<64>(buffer);
+
+    CircularBytesWriter<64> writer(buffer, Key<KEY>{});
+    EXPECT_EQ(data->crc, crc32(KEY));
+    EXPECT_TRUE(writer.write(as_bytes("hello")));
+    CircularBytesReader<64> reader(buffer, KEY);
+    EXPECT_EQ(read_string(reader), "hello");
+}
+
+TEST(CircularBytesTest, write_read) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    CircularBytesWriter<64> writer(buffer, KEY);
+    CircularBytesReader<64> reader(buffer, KEY);
+
+    EXPECT_EQ(read_string(reader), "<none>");
+    EXPECT_TRUE(writer.write(as_bytes("a")));
+    EXPECT_TRUE(writer.write(as_bytes("")));
+    EXPECT_TRUE(writer.write(as_bytes("variable length")));
+    EXPECT_EQ(read_string(reader), "a");
+    EXPECT_EQ(read_string(reader), "");
+    EXPECT_EQ(read_string(reader), "variable length");
+    EXPECT_EQ(read_string(reader), "<none>");
+}
+
+TEST(CircularBytesTest, too_large) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<64>(buffer);
+
+    CircularBytesWriter<64> writer(buffer, KEY);
+    CircularBytesReader<64> reader(buffer, KEY);
+
+    const std::string largest(CircularBytesWriter<64>::MAX_RECORD_SIZE, 'x');
+    EXPECT_FALSE(writer.write(as_bytes(largest + "x")));
+    EXPECT_EQ(data->write_head.index, 0u);
+    EXPECT_EQ(data->write_head.lap, 0u);
+
+    EXPECT_TRUE(writer.write(as_bytes(largest)));
+    EXPECT_EQ(data->write_head.index, 0u);
+    EXPECT_EQ(data->write_head.lap, 1u);
+    EXPECT_EQ(read_string(reader), largest);
+}
+
+TEST(CircularBytesTest, small_output_keeps_record) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<64>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    CircularBytesWriter<64> writer(buffer, KEY);
+    CircularBytesReader<64> reader(buffer, KEY);
+
+    EXPECT_TRUE(writer.write(as_bytes("0123456789")));
+    uint8_t small[4];
+    size_t size = 0;
+    EXPECT_FALSE(reader.read(small, size));
+    EXPECT_EQ(size, 10u);
+    EXPECT_EQ(read_string(reader), "0123456789");
+}
+
+TEST(CircularBytesTest, wrap_padding) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<32>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<32>(buffer);
+
+    CircularBytesWriter<32> writer(buffer, KEY);
+    CircularBytesReader<32> reader(buffer, KEY);
+
+    EXPECT_TRUE(writer.write(as_bytes("0123456789"))); // 16 bytes
+    EXPECT_TRUE(writer.write(as_bytes("abc")));        // 8 bytes
+    EXPECT_EQ(read_string(reader), "0123456789");
+    EXPECT_EQ(read_string(reader), "abc");
+
+    // 12 bytes do not fit in the 8 bytes left: the tail is padded
+    EXPECT_TRUE(writer.write(as_bytes("ABCDEFGH")));
+    EXPECT_EQ(data->write_head.index, 12u);
+    EXPECT_EQ(data->write_head.lap, 1u);
+    uint32_t marker;
+    ::memcpy(&marker, &data->data[24], sizeof(marker));
+    EXPECT_EQ(marker, CircularBytesMock<CircularBytes<32>>::PADDING);
+
+    EXPECT_EQ(read_string(reader), "ABCDEFGH");
+    EXPECT_EQ(data->read_head.index, 12u);
+    EXPECT_EQ(data->read_head.lap, 1u);
+    EXPECT_EQ(read_string(reader), "<none>");
+}
+
+TEST(CircularBytesTest, overrun_skips_to_write_head) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<32>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<32>(buffer);
+
+    CircularBytesWriter<32> writer(buffer, KEY);
+    CircularBytesReader<32> reader(buffer, KEY);
+
+    // exactly one lap of unread data is still readable
+    for (const auto text : { "0123", "4567", "89ab", "cdef" }) {
+        EXPECT_TRUE(writer.write(as_bytes(text)));
+    }
+    EXPECT_EQ(read_string(reader), "0123");
+
+    for (const auto text : { "ghij", "klmn", "opqr" }) {
+        EXPECT_TRUE(writer.write(as_bytes(text)));
+    }
+    std::vector<uint8_t> record(32);
+    size_t size = 1;
+    size_t dropped = 0;
+    EXPECT_FALSE(reader.read(record, size, dropped));
+    EXPECT_EQ(size, 0u);
+    EXPECT_EQ(dropped, 48u); // "4567" to "opqr", of which the last three are still there
+    EXPECT_EQ(data->read_head.index, data->write_head.index);
+    EXPECT_EQ(data->read_head.lap, data->write_head.lap);
+
+    EXPECT_TRUE(writer.write(as_bytes("stuv")));
+    EXPECT_EQ(read_string(reader), "stuv");
+}
+
+TEST(CircularBytesTest, corrupted_length_resynchronises) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<32>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<32>(buffer);
+
+    CircularBytesWriter<32> writer(buffer, KEY);
+    CircularBytesReader<32> reader(buffer, KEY);
+
+    EXPECT_TRUE(writer.write(as_bytes("0123")));
+    EXPECT_TRUE(writer.write(as_bytes("4567")));
+    const uint32_t bogus = 1000;
+    ::memcpy(&data->data[0], &bogus, sizeof(bogus));
+
+    std::vector<uint8_t> record(32);
+    size_t size = 1;
+    size_t dropped = 0;
+    EXPECT_FALSE(reader.read(record, size, dropped));
+    EXPECT_EQ(size, 0u);
+    EXPECT_EQ(dropped, 16u);
+    EXPECT_FALSE(reader.read(record, size, dropped));
+    EXPECT_EQ(dropped, 0u); // empty, nothing lost
+    EXPECT_TRUE(writer.write(as_bytes("89ab")));
+    EXPECT_EQ(read_string(reader), "89ab");
+}
+
+TEST(CircularBytesTest, torn_record_resynchronises) {
+    constexpr uint64_t KEY = 0x1234;
+    uint8_t buffer[CircularBytes<32>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<32>(buffer);
+
+    CircularBytesWriter<32> writer(buffer, KEY);
+    CircularBytesReader<32> reader(buffer, KEY);
+
+    EXPECT_TRUE(writer.write(as_bytes("0123")));
+    EXPECT_TRUE(writer.write(as_bytes("4567")));
+    EXPECT_EQ(data->claim_head.index, data->write_head.index);
+    EXPECT_EQ(data->claim_head.lap, data->write_head.lap);
+    // a writer stopped while writing over the first record, a lap later
+    data->claim_head = { 8, 1 };
+
+    std::vector<uint8_t> record(32);
+    size_t size = 1;
+    size_t dropped = 0;
+    EXPECT_FALSE(reader.read(record, size, dropped));
+    EXPECT_EQ(size, 0u);
+    EXPECT_EQ(dropped, 16u);
+    EXPECT_EQ(data->read_head.index, data->write_head.index);
+    EXPECT_EQ(data->read_head.lap, data->write_head.lap);
+    EXPECT_TRUE(writer.write(as_bytes("89ab")));
+    EXPECT_EQ(read_string(reader), "89ab");
+}
+
+TEST(CircularBytesTest, concurrent_in_order) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 256;
+    uint8_t buffer[CircularBytes<N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    constexpr uint32_t TOTAL = 100'000;
+    // throttles the writer so that it never overruns the reader: two records of at most 80
+    // bytes plus at most 76 bytes of padding always fit in the buffer
+    std::atomic<uint32_t> consumed = 0;
+
+    std::thread producer([&] {
+        CircularBytesWriter<N> writer(buffer, KEY);
+        for (uint32_t i = 0; i < TOTAL; ++i) {
+            while (i - consumed.load(std::memory_order_acquire) >= 2) {
+                std::this_thread::yield();
+            }
+            // records of 0 to 19 copies of i
+            std::vector<uint32_t> record(i % 20, i);
+            writer.write(
+                  { reinterpret_cast<const uint8_t*>(record.data()),
+                    record.size() * sizeof(uint32_t) });
+        }
+    });
+
+    CircularBytesReader<N> reader(buffer, KEY);
+    uint32_t errors = 0;
+    std::vector<uint32_t> record(N / sizeof(uint32_t));
+    for (uint32_t i = 0; i < TOTAL; ++i) {
+        size_t size = 0;
+        const std::span<uint8_t> out(reinterpret_cast<uint8_t*>(record.data()), N);
+        while (not reader.read(out, size)) {
+            std::this_thread::yield();
+        }
+        errors += size != (i % 20) * sizeof(uint32_t);
+        for (size_t j = 0; j < size / sizeof(uint32_t); ++j) {
+            errors += record[j] != i;
+        }
+        consumed.store(i + 1, std::memory_order_release);
+    }
+    producer.join();
+
+    EXPECT_EQ(errors, 0u);
+}
+} // namespace brasa::buffer::detail
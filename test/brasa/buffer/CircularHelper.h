@@ -41,8 +41,9 @@ bool operator==(const BufferData<TYPE, N>& X, const BufferData<TYPE, N>& Y) {
         }
         return true;
     };
-    return X.write_head == Y.write_head && X.read_head == Y.read_head && X.key == Y.key
-           && X.crc == Y.crc && are_equal(X.data, Y.data);
+    return X.write_head == Y.write_head && X.claim_head == Y.claim_head
+           && X.read_head == Y.read_head && X.key == Y.key && X.crc == Y.crc
+           && X.blocking == Y.blocking && are_equal(X.data, Y.data);
 }
 
 template <typename TYPE, uint32_t N>
@@ -50,6 +51,23 @@ bool operator!=(const BufferData<TYPE, N>& X, const BufferData<TYPE, N>& Y) {
     return not(X == Y);
 }
 
+template <typename TYPE, uint32_t N>
+bool operator==(const BufferDataPadded<TYPE, N>& X, const BufferDataPadded<TYPE, N>& Y) {
+    for (size_t i = 0; i < N; ++i) {
+        if (X.data[i] != Y.data[i]) {
+            return false;
+        }
+    }
+    return X.write_head == Y.write_head && X.claim_head == Y.claim_head
+           && X.read_head == Y.read_head && X.write_head_cache == Y.write_head_cache
+           && X.key == Y.key && X.crc == Y.crc && X.blocking == Y.blocking;
+}
+
+template <typename TYPE, uint32_t N>
+bool operator!=(const BufferDataPadded<TYPE, N>& X, const BufferDataPadded<TYPE, N>& Y) {
+    return not(X == Y);
+}
+
 inline std::ostream& operator<<(std::ostream& out, const Head& x) {
     out << "off = " << x.index << " | lap = " << x.lap;
     return out;
@@ -66,5 +84,18 @@ inline std::ostream& operator<<(std::ostream& out, const BufferData<TYPE, N>& x)
     }
     return out;
 }
+
+template <typename TYPE, uint32_t N>
+inline std::ostream& operator<<(std::ostream& out, const BufferDataPadded<TYPE, N>& x) {
+    out << "key = " << x.key << " | crc " << x.crc << "\n";
+    out << "WH = [" << x.write_head << "]\n";
+    out << "RH = [" << x.read_head << "]\n";
+    out << "WC = [" << x.write_head_cache << "]\n";
+
+    for (size_t i = 0; i < N; ++i) {
+        out << "el " << i << " [" << x.data[i] << "]\n";
+    }
+    return out;
+}
 } // namespace detail
 } // namespace brasa::buffer
@@ -0,0 +1,146 @@
+#include <brasa/buffer/CircularBroadcastReader.h>
+#include <brasa/buffer/CircularMonitor.h>
+#include <brasa/buffer/CircularReader.h>
+#include <brasa/buffer/CircularWriter.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace brasa::buffer {
+
+namespace {
+
+constexpr uint64_t KEY = 0x3017;
+
+void expect_stats(
+      const CircularStats& stats,
+      uint64_t written,
+      uint64_t read,
+      uint64_t dropped,
+      uint64_t max_lag,
+      uint64_t lag) {
+    EXPECT_EQ(stats.written, written);
+    EXPECT_EQ(stats.read, read);
+    EXPECT_EQ(stats.dropped, dropped);
+    EXPECT_EQ(stats.max_lag, max_lag);
+    EXPECT_EQ(stats.lag, lag);
+}
+} // namespace
+
+TEST(CircularMonitorTest, counts_reads_and_drops) {
+    constexpr uint32_t N = 8;
+    std::vector<uint8_t> buffer(CircularWriter<int, N>::MIN_BUFFER_SIZE);
+    const CircularMonitor<int, N> monitor(buffer.data(), KEY);
+    EXPECT_FALSE(monitor.is_initialized());
+    expect_stats(monitor.stats(), 0, 0, 0, 0, 0);
+
+    CircularWriter<int, N> writer(buffer.data(), KEY);
+    CircularReader<int, N> reader(buffer.data(), KEY);
+    EXPECT_TRUE(monitor.is_initialized());
+
+    for (int i = 0; i < 3; ++i) {
+        writer.write(i);
+    }
+    expect_stats(monitor.stats(), 3, 0, 0, 0, 3);
+
+    int value;
+    std::size_t dropped = 99;
+    EXPECT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 0);
+    EXPECT_EQ(dropped, 0u);
+    expect_stats(monitor.stats(), 3, 1, 0, 3, 2);
+
+    // 2 unread and 20 more: the 14 oldest are lost
+    for (int i = 3; i < 23; ++i) {
+        writer.write(i);
+    }
+    EXPECT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 15);
+    EXPECT_EQ(dropped, 14u);
+    expect_stats(monitor.stats(), 23, 2, 14, 22, 7);
+
+    std::vector<int> values(10);
+    EXPECT_EQ(reader.read(values, dropped), 7u);
+    EXPECT_EQ(dropped, 0u);
+    EXPECT_EQ(values[0], 16);
+    expect_stats(monitor.stats(), 23, 9, 14, 22, 0);
+
+    // batch read after an overrun
+    for (int i = 23; i < 40; ++i) {
+        writer.write(i);
+    }
+    EXPECT_EQ(reader.read(values, dropped), 8u);
+    EXPECT_EQ(dropped, 9u);
+    EXPECT_EQ(values[0], 32);
+    expect_stats(monitor.stats(), 40, 17, 23, 22, 0);
+
+    // peek/release
+    for (int i = 40; i < 60; ++i) {
+        writer.write(i);
+    }
+    const auto peeked = reader.peek();
+    ASSERT_FALSE(peeked.empty());
+    EXPECT_EQ(peeked[0], 52);
+    expect_stats(monitor.stats(), 60, 17, 35, 22, 8);
+    reader.release(peeked.size());
+    expect_stats(monitor.stats(), 60, 17 + peeked.size(), 35, 22, 8 - peeked.size());
+}
+
+TEST(CircularMonitorTest, padded_counts_reads_and_drops) {
+    constexpr uint32_t N = 8;
+    std::vector<uint8_t> buffer(PaddedCircularWriter<int, N>::MIN_BUFFER_SIZE);
+    PaddedCircularWriter<int, N> writer(buffer.data(), KEY);
+    PaddedCircularReader<int, N> reader(buffer.data(), KEY);
+    const CircularMonitor<int, N, detail::BufferDataPadded> monitor(buffer.data(), KEY);
+
+    for (int i = 0; i < 3; ++i) {
+        writer.write(i);
+    }
+    int value;
+    std::size_t dropped = 99;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(reader.read(value, dropped));
+        EXPECT_EQ(dropped, 0u);
+    }
+    expect_stats(monitor.stats(), 3, 3, 0, 3, 0);
+
+    // overruns are detected when the reader refreshes its copy of the write head
+    for (int i = 3; i < 23; ++i) {
+        writer.write(i);
+    }
+    EXPECT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 15);
+    EXPECT_EQ(dropped, 12u);
+    expect_stats(monitor.stats(), 23, 4, 12, 20, 7);
+}
+
+TEST(CircularMonitorTest, wrong_key) {
+    constexpr uint32_t N = 8;
+    std::vector<uint8_t> buffer(CircularWriter<int, N>::MIN_BUFFER_SIZE);
+    CircularWriter<int, N> writer(buffer.data(), KEY);
+    writer.write(1);
+
+    const CircularMonitor<int, N> monitor(buffer.data(), KEY + 1);
+    EXPECT_FALSE(monitor.is_initialized());
+    expect_stats(monitor.stats(), 0, 0, 0, 0, 0);
+}
+
+TEST(CircularMonitorTest, broadcast_readers_report_drops_only_per_read) {
+    constexpr uint32_t N = 8;
+    std::vector<uint8_t> buffer(CircularWriter<int, N>::MIN_BUFFER_SIZE);
+    CircularWriter<int, N> writer(buffer.data(), KEY);
+    CircularBroadcastReader<int, N> reader(buffer.data(), KEY);
+    const CircularMonitor<int, N> monitor(buffer.data(), KEY);
+
+    for (int i = 0; i < 10; ++i) {
+        writer.write(i);
+    }
+    int value;
+    std::size_t dropped = 0;
+    EXPECT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 2);
+    EXPECT_EQ(dropped, 2u);
+    expect_stats(monitor.stats(), 10, 0, 0, 0, 10);
+}
+} // namespace brasa::buffer
@@ -1,12 +1,22 @@
 #include <../test/brasa/buffer/CircularHelper.h>
 
 #include <brasa/buffer/Circular.h>
+#include <brasa/buffer/CircularBroadcastReader.h>
 #include <brasa/buffer/CircularReader.h>
 #include <brasa/buffer/CircularWriter.h>
 
 #include <gtest/gtest.h>
 
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
 #include <source_location>
+#include <thread>
+#include <vector>
 
 namespace brasa::buffer::detail {
 
@@ -51,8 +61,10 @@ void verify_create_uninitialized(const uint64_t KEY) {
     EXPECT_EQ(buffer_data->read_head.lap, 0u);
     EXPECT_EQ(buffer_data->write_head.index, 0u);
     EXPECT_EQ(buffer_data->write_head.lap, 0u);
+    EXPECT_EQ(buffer_data->claim_head, buffer_data->write_head);
     EXPECT_EQ(buffer_data->key, KEY);
     EXPECT_EQ(buffer_data->crc, crc32(KEY));
+    EXPECT_EQ(buffer_data->blocking, 0u);
 
     uint8_t buffer2[CIRCULAR::MIN_BUFFER_SIZE];
     ::memset(buffer2, 0x55, sizeof(buffer2));
@@ -113,6 +125,7 @@ void verify_create_initialized(const uint64_t KEY) {
     buffer_data->write_head.index = 2;
     buffer_data->read_head.lap = 11;
     buffer_data->write_head.lap = 17;
+    buffer_data->claim_head = buffer_data->write_head;
 
     // if the buffer is already initialized, the creation of a circular buffer does not alter
     // underlying memory
@@ -130,6 +143,32 @@ void verify_create_initialized(const uint64_t KEY) {
 }
 } // namespace
 
+TEST(CircularTest, compile_time_key) {
+    constexpr uint64_t KEY = 0x1234'5678'90ab'cdefUL;
+    using BufferDataT = BufferData<int, 7>;
+    uint8_t buffer[Circular<int, 7>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, 7>::aligned_in_buffer(buffer));
+
+    // a key given as a type and the same key given as a value attach to the same buffer
+    CircularWriter<int, 7> writer(buffer, Key<KEY>{});
+    EXPECT_EQ(buffer_data->key, KEY);
+    EXPECT_EQ(buffer_data->crc, crc32(KEY));
+    CircularReader<int, 7> reader(buffer, KEY);
+    CircularBroadcastReader<int, 7> broadcast(buffer, Key<KEY>{});
+    writer.write(42);
+    int value = -1;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(broadcast.read(value));
+    EXPECT_EQ(value, 42);
+
+    // as with a value, another key resets the buffer
+    CircularReader<int, 7> other(buffer, Key<KEY + 1>{});
+    EXPECT_EQ(buffer_data->key, KEY + 1);
+    EXPECT_EQ(buffer_data->write_head, Head({ 0, 0 }));
+}
+
 TEST(CircularTest, create_initialized) {
     verify_create_initialized<CircularReader<data, 47>>(12'345);
     verify_create_initialized<CircularReader<int, 357>>(22'222);
@@ -185,6 +224,7 @@ TEST(CircularTest, write) {
     Head write_head = { 1, 0 };
     ::memcpy(&buffer_data2->data[0], &d, sizeof(d));
     ::memcpy(&buffer_data2->write_head, &write_head, sizeof(Head));
+    ::memcpy(&buffer_data2->claim_head, &write_head, sizeof(Head));
 
     EXPECT_EQ(*buffer_data, *buffer_data2);
 
@@ -199,6 +239,7 @@ TEST(CircularTest, write) {
 
     ::memcpy(&buffer_data2->data[1], &d, sizeof(d));
     ::memcpy(&buffer_data2->write_head, &write_head, sizeof(Head));
+    ::memcpy(&buffer_data2->claim_head, &write_head, sizeof(Head));
 
     EXPECT_EQ(*buffer_data, *buffer_data2);
 }
@@ -237,6 +278,7 @@ void verify_laps(const uint64_t key) {
         h.lap = (i + 1) / N;
         ::memcpy(&buffer_data2->data[off_idx], &t1, sizeof(t1));
         ::memcpy(&buffer_data2->write_head, &h, sizeof(h));
+        ::memcpy(&buffer_data2->claim_head, &h, sizeof(h));
 
         EXPECT_EQ(*buffer_data1, *buffer_data2);
 
@@ -257,18 +299,17 @@ TEST(CircularTest, laps) {
 }
 
 namespace {
-template <typename TYPE, uint32_t N>
+template <typename TYPE, uint32_t N, template <typename, uint32_t> typename LAYOUT = BufferData>
 void verify_many_laps_one_read(uint64_t key) {
-    using CircularBuffer = Circular<TYPE, N>;
+    using CircularBuffer = Circular<TYPE, N, LAYOUT>;
 
     SCOPED_TRACE("For key " + std::to_string(key));
 
     uint8_t buffer[CircularBuffer::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
 
-    initialize_buffer<TYPE, N>(buffer, key);
-
-    CircularWriter<TYPE, N> writer(buffer, key);
-    CircularReader<TYPE, N> reader(buffer, key);
+    CircularWriter<TYPE, N, LAYOUT> writer(buffer, key);
+    CircularReader<TYPE, N, LAYOUT> reader(buffer, key);
 
     constexpr uint32_t MAX = 3 * N + 7;
     TYPE t1;
@@ -291,5 +332,878 @@ TEST(CircularTest, manyLapsOneRead) {
     verify_many_laps_one_read<data, 27>(13);
     verify_many_laps_one_read<int, 278>(14);
     verify_many_laps_one_read<int, 27>(15);
+    verify_many_laps_one_read<data, 27, BufferDataPadded>(16);
+    verify_many_laps_one_read<int, 278, BufferDataPadded>(17);
+}
+
+namespace {
+template <template <typename, uint32_t> typename LAYOUT>
+void verify_overrun_after_partial_reads() {
+    constexpr uint32_t N = 4;
+    constexpr uint64_t KEY = 0xd0d0;
+    uint8_t buffer[Circular<int, N, LAYOUT>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    CircularWriter<int, N, LAYOUT> writer(buffer, KEY);
+    CircularReader<int, N, LAYOUT> reader(buffer, KEY);
+
+    // reads that leave the write head cached by the padded reader one lap behind the writer
+    int next = 0;
+    int value = -1;
+    size_t dropped = 0;
+    for (const auto count : { 1, 1, 2 }) {
+        for (int i = 0; i < count; ++i) {
+            writer.write(next++);
+        }
+        ASSERT_TRUE(reader.read(value, dropped));
+    }
+    EXPECT_EQ(value, 2);
+
+    // 3 to 6 are overwritten, and each element after them is read exactly once
+    for (int i = 0; i < 7; ++i) {
+        writer.write(next++);
+    }
+    ASSERT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(dropped, 4u);
+    for (int expected = 8; expected < next; ++expected) {
+        ASSERT_TRUE(reader.read(value, dropped));
+        EXPECT_EQ(value, expected);
+        EXPECT_EQ(dropped, 0u);
+    }
+    EXPECT_FALSE(reader.read(value, dropped));
+    EXPECT_EQ(dropped, 0u);
+}
+} // namespace
+
+TEST(CircularTest, overrun_after_partial_reads) {
+    {
+        SCOPED_TRACE("compact layout");
+        verify_overrun_after_partial_reads<BufferData>();
+    }
+    {
+        SCOPED_TRACE("padded layout");
+        verify_overrun_after_partial_reads<BufferDataPadded>();
+    }
+}
+
+namespace {
+struct Sequence {
+    uint64_t value;
+    uint64_t complement;
+};
+
+template <uint32_t N>
+void verify_concurrent_in_order(const uint64_t key) {
+    SCOPED_TRACE("For key " + std::to_string(key) + " / N = " + std::to_string(N));
+
+    uint8_t buffer[Circular<Sequence, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<Sequence, N>(buffer, key);
+
+    constexpr uint64_t TOTAL = 200'000;
+    // throttles the writer so that it never laps the reader
+    std::atomic<uint64_t> consumed = 0;
+
+    std::thread producer([&] {
+        CircularWriter<Sequence, N> writer(buffer, key);
+        for (uint64_t i = 0; i < TOTAL; ++i) {
+            while (i - consumed.load(std::memory_order_acquire) >= N - 1) {
+                std::this_thread::yield();
+            }
+            writer.write({ i, ~i });
+        }
+    });
+
+    CircularReader<Sequence, N> reader(buffer, key);
+    uint64_t errors = 0;
+    for (uint64_t i = 0; i < TOTAL; ++i) {
+        Sequence sequence;
+        while (not reader.read(sequence)) {
+            std::this_thread::yield();
+        }
+        errors += sequence.value != i || sequence.complement != ~i;
+        consumed.store(i + 1, std::memory_order_release);
+    }
+    producer.join();
+
+    EXPECT_EQ(errors, 0u);
+}
+} // namespace
+
+TEST(CircularTest, concurrent_in_order) {
+    verify_concurrent_in_order<2>(0x1234);
+    verify_concurrent_in_order<16>(0x5678);
+    verify_concurrent_in_order<1024>(0x9abc);
+}
+
+TEST(CircularTest, padded_layout_separates_heads) {
+    using BufferDataT = BufferDataPadded<data, 27>;
+    static_assert(offsetof(BufferDataT, write_head) % CACHE_LINE_SIZE == 0);
+    static_assert(offsetof(BufferDataT, read_head) % CACHE_LINE_SIZE == 0);
+    static_assert(offsetof(BufferDataT, key) % CACHE_LINE_SIZE == 0);
+    static_assert(
+          offsetof(BufferDataT, read_head) - offsetof(BufferDataT, write_head)
+          >= CACHE_LINE_SIZE);
+    static_assert(
+          offsetof(BufferDataT, claim_head) - offsetof(BufferDataT, write_head)
+          >= CACHE_LINE_SIZE);
+    static_assert(
+          offsetof(BufferDataT, read_head) - offsetof(BufferDataT, claim_head)
+          >= CACHE_LINE_SIZE);
+    static_assert(offsetof(BufferDataT, key) - offsetof(BufferDataT, read_head) >= CACHE_LINE_SIZE);
+    static_assert(
+          offsetof(BufferDataT, write_head_cache) - offsetof(BufferDataT, read_head)
+          < CACHE_LINE_SIZE);
+    static_assert(alignof(BufferDataT) == CACHE_LINE_SIZE);
+}
+
+TEST(CircularTest, padded_create_uninitialized) {
+    using CircularBuffer = PaddedCircularWriter<data, 27>;
+    using BufferDataT = typename CircularMock<CircularBuffer>::BufferDataT;
+    constexpr uint64_t KEY = 0x1234'5678'90ab'cdefUL;
+
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[CircularBuffer::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto buffer_data = reinterpret_cast<BufferDataT*>(buffer);
+
+    const CircularBuffer circular(buffer, KEY);
+    EXPECT_EQ(buffer_data->read_head, Head{});
+    EXPECT_EQ(buffer_data->write_head, Head{});
+    EXPECT_EQ(buffer_data->write_head_cache, Head{});
+    EXPECT_EQ(buffer_data->key, KEY);
+    EXPECT_EQ(buffer_data->crc, crc32(KEY));
+}
+
+TEST(CircularTest, padded_reader_caches_write_head) {
+    using BufferDataT = BufferDataPadded<data, 15>;
+    constexpr uint64_t KEY = 0xfeed'beefUL;
+
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[PaddedCircularWriter<data, 15>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto buffer_data = reinterpret_cast<BufferDataT*>(buffer);
+
+    PaddedCircularWriter<data, 15> writer(buffer, KEY);
+    PaddedCircularReader<data, 15> reader(buffer, KEY);
+
+    for (int i = 0; i < 3; ++i) {
+        writer.write({ i, 'a' });
+    }
+
+    data d;
+    ASSERT_TRUE(reader.read(d));
+    EXPECT_EQ(d, data({ 0, 'a' }));
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 3, 0 }));
+
+    // the cached write head is enough while it is ahead of the read head
+    writer.write({ 3, 'a' });
+    ASSERT_TRUE(reader.read(d));
+    EXPECT_EQ(d, data({ 1, 'a' }));
+    ASSERT_TRUE(reader.read(d));
+    EXPECT_EQ(d, data({ 2, 'a' }));
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 3, 0 }));
+
+    // the write head is reloaded once the cached copy says the buffer is empty
+    ASSERT_TRUE(reader.read(d));
+    EXPECT_EQ(d, data({ 3, 'a' }));
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 4, 0 }));
+    EXPECT_FALSE(reader.read(d));
+    EXPECT_EQ(buffer_data->read_head, Head({ 4, 0 }));
+}
+
+TEST(CircularTest, padded_invalid_cache_reinitializes) {
+    using BufferDataT = BufferDataPadded<int, 15>;
+    constexpr uint64_t KEY = 0xfeed'beefUL;
+
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[PaddedCircularWriter<int, 15>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto buffer_data = reinterpret_cast<BufferDataT*>(buffer);
+
+    { // scope for the first writer
+        PaddedCircularWriter<int, 15> writer(buffer, KEY);
+        writer.write(5);
+    }
+    PaddedCircularWriter<int, 15> writer(buffer, KEY);
+    EXPECT_EQ(buffer_data->write_head, Head({ 1, 0 }));
+
+    buffer_data->write_head_cache = { 3, 0 }; // ahead of the write head
+    PaddedCircularReader<int, 15> reader(buffer, KEY);
+    EXPECT_EQ(buffer_data->write_head, Head{});
+    EXPECT_EQ(buffer_data->write_head_cache, Head{});
+}
+
+TEST(CircularTest, padded_concurrent_in_order) {
+    constexpr uint64_t KEY = 0x4321;
+    constexpr uint32_t N = 64;
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[PaddedCircularWriter<Sequence, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    constexpr uint64_t TOTAL = 200'000;
+    std::atomic<uint64_t> consumed = 0;
+
+    std::thread producer([&] {
+        PaddedCircularWriter<Sequence, N> writer(buffer, KEY);
+        for (uint64_t i = 0; i < TOTAL; ++i) {
+            while (i - consumed.load(std::memory_order_acquire) >= N - 1) {
+                std::this_thread::yield();
+            }
+            writer.write({ i, ~i });
+        }
+    });
+
+    PaddedCircularReader<Sequence, N> reader(buffer, KEY);
+    uint64_t errors = 0;
+    for (uint64_t i = 0; i < TOTAL; ++i) {
+        Sequence sequence;
+        while (not reader.read(sequence)) {
+            std::this_thread::yield();
+        }
+        errors += sequence.value != i || sequence.complement != ~i;
+        consumed.store(i + 1, std::memory_order_release);
+    }
+    producer.join();
+
+    EXPECT_EQ(errors, 0u);
+}
+
+namespace {
+template <uint32_t N>
+void verify_batch_write_equals_single_writes(const std::vector<size_t>& batch_sizes) {
+    using BufferDataT = BufferData<int, N>;
+    constexpr uint64_t KEY = 0xabcd;
+    SCOPED_TRACE("N = " + std::to_string(N));
+
+    uint8_t buffer1[Circular<int, N>::MIN_BUFFER_SIZE];
+    uint8_t buffer2[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer1, KEY);
+    initialize_buffer<int, N>(buffer2, KEY);
+    using CircularT = Circular<int, N>;
+    auto buffer_data1 = reinterpret_cast<BufferDataT*>(CircularT::aligned_in_buffer(buffer1));
+    auto buffer_data2 = reinterpret_cast<BufferDataT*>(CircularT::aligned_in_buffer(buffer2));
+
+    CircularWriter<int, N> batch_writer(buffer1, KEY);
+    CircularWriter<int, N> single_writer(buffer2, KEY);
+
+    int next = 0;
+    for (const auto batch_size : batch_sizes) {
+        SCOPED_TRACE("batch of " + std::to_string(batch_size));
+        std::vector<int> values(batch_size);
+        std::iota(values.begin(), values.end(), next);
+        next += int(batch_size);
+
+        batch_writer.write(values);
+        for (const auto value : values) {
+            single_writer.write(value);
+        }
+        EXPECT_EQ(*buffer_data1, *buffer_data2);
+    }
+}
+} // namespace
+
+TEST(CircularTest, batch_write) {
+    verify_batch_write_equals_single_writes<7>({ 0, 1, 3, 5, 7, 2, 6, 13, 22, 4 });
+    verify_batch_write_equals_single_writes<32>({ 31, 1, 32, 33, 65, 17, 16, 0, 64 });
+}
+
+TEST(CircularTest, batch_read) {
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+
+    std::vector<int> values(10, -1);
+    EXPECT_EQ(reader.read(values), 0u);
+    EXPECT_EQ(values, std::vector<int>(10, -1));
+
+    writer.write(std::vector{ 0, 1, 2, 3, 4 });
+    EXPECT_EQ(reader.read(std::span(values).first(2)), 2u);
+    EXPECT_EQ(values[0], 0);
+    EXPECT_EQ(values[1], 1);
+
+    // wraps around the end of the buffer
+    writer.write(std::vector{ 5, 6, 7, 8 });
+    EXPECT_EQ(reader.read(values), 7u);
+    values.resize(7);
+    EXPECT_EQ(values, std::vector({ 2, 3, 4, 5, 6, 7, 8 }));
+    values.resize(10);
+    EXPECT_EQ(reader.read(values), 0u);
+
+    // interleaves with single element reads
+    writer.write(std::vector{ 9, 10, 11 });
+    int value = -1;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 9);
+    EXPECT_EQ(reader.read(values), 2u);
+    EXPECT_EQ(values[0], 10);
+    EXPECT_EQ(values[1], 11);
+    EXPECT_FALSE(reader.read(value));
+}
+
+TEST(CircularTest, batch_read_after_overrun) {
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+
+    std::vector<int> values(3 * N + 4);
+    std::iota(values.begin(), values.end(), 0);
+    writer.write(values);
+
+    std::vector<int> read(2 * N, -1);
+    ASSERT_EQ(reader.read(read), N);
+    read.resize(N);
+    EXPECT_EQ(read, std::vector(values.end() - N, values.end()));
+}
+
+TEST(CircularTest, padded_batch_read) {
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[PaddedCircularWriter<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    PaddedCircularWriter<int, N> writer(buffer, KEY);
+    PaddedCircularReader<int, N> reader(buffer, KEY);
+
+    std::vector<int> values(5, -1);
+    writer.write(std::vector{ 0, 1 });
+    EXPECT_EQ(reader.read(std::span(values).first(1)), 1u);
+    EXPECT_EQ(values[0], 0);
+
+    // the cached write head only covers one element, so the batch reloads it
+    writer.write(std::vector{ 2, 3 });
+    EXPECT_EQ(reader.read(values), 3u);
+    EXPECT_EQ(std::vector(values.begin(), values.begin() + 3), std::vector({ 1, 2, 3 }));
+}
+
+TEST(CircularTest, claim_commit) {
+    constexpr uint32_t N = 5;
+    constexpr uint64_t KEY = 0xabcd;
+    using BufferDataT = BufferData<data, N>;
+    uint8_t buffer[Circular<data, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<data, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<data, N>::aligned_in_buffer(buffer));
+
+    CircularWriter<data, N> writer(buffer, KEY);
+    CircularReader<data, N> reader(buffer, KEY);
+
+    data& slot = writer.claim();
+    EXPECT_EQ(&slot, &buffer_data->data[0]);
+    slot = { 10, 'a' };
+
+    // nothing is visible before the commit
+    data d;
+    EXPECT_FALSE(reader.read(d));
+    writer.commit();
+    ASSERT_TRUE(reader.read(d));
+    EXPECT_EQ(d, data({ 10, 'a' }));
+
+    // a run of slots stops at the end of the buffer
+    auto slots = writer.claim(10);
+    ASSERT_EQ(slots.size(), 4u);
+    EXPECT_EQ(slots.data(), &buffer_data->data[1]);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        slots[i] = { int(i + 11), 'b' };
+    }
+    writer.commit(3);
+    EXPECT_EQ(buffer_data->write_head, Head({ 4, 0 }));
+
+    slots = writer.claim(3);
+    ASSERT_EQ(slots.size(), 1u);
+    slots[0] = { 14, 'c' };
+    writer.commit(1);
+    slots = writer.claim(3);
+    ASSERT_EQ(slots.size(), 3u);
+    EXPECT_EQ(slots.data(), &buffer_data->data[0]);
+    EXPECT_EQ(buffer_data->write_head, Head({ 0, 1 }));
+
+    // the unread slots handed out by the claim may be overwritten at any time
+    std::vector<data> values(10);
+    size_t dropped = 0;
+    ASSERT_EQ(reader.read(values, dropped), 2u);
+    EXPECT_EQ(dropped, 2u);
+    EXPECT_EQ(values[0], data({ 13, 'b' }));
+    EXPECT_EQ(values[1], data({ 14, 'c' }));
+}
+
+TEST(CircularTest, partial_commit_withdraws_the_rest_of_the_claim) {
+    constexpr uint32_t N = 4;
+    constexpr uint64_t KEY = 0xabce;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+
+    writer.write(std::vector{ 0, 1, 2, 3 });
+    int value = -1;
+    ASSERT_TRUE(reader.read(value));
+
+    // only the slot of 0 is overwritten, the ones of 1 and 2 still hold them
+    auto slots = writer.claim(3);
+    ASSERT_EQ(slots.size(), 3u);
+    slots[0] = 4;
+    writer.commit(1);
+    EXPECT_EQ(buffer_data->claim_head, buffer_data->write_head);
+
+    std::vector<int> values(N, -1);
+    size_t dropped = 0;
+    EXPECT_EQ(reader.read(values, dropped), 4u);
+    EXPECT_EQ(values, std::vector({ 1, 2, 3, 4 }));
+    EXPECT_EQ(dropped, 0u);
+}
+
+TEST(CircularTest, peek_release) {
+    constexpr uint32_t N = 5;
+    constexpr uint64_t KEY = 0xabcd;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+
+    EXPECT_TRUE(reader.peek().empty());
+
+    writer.write(std::vector{ 0, 1, 2, 3 });
+    auto slots = reader.peek();
+    ASSERT_EQ(slots.size(), 4u);
+    EXPECT_EQ(slots.data(), &buffer_data->data[0]);
+    EXPECT_EQ(slots[3], 3);
+
+    // peeking does not consume
+    EXPECT_EQ(reader.peek().size(), 4u);
+    reader.release(3);
+    EXPECT_EQ(buffer_data->read_head, Head({ 3, 0 }));
+
+    // the run stops at the end of the buffer
+    writer.write(std::vector{ 4, 5, 6 });
+    slots = reader.peek();
+    ASSERT_EQ(slots.size(), 2u);
+    EXPECT_EQ(slots[0], 3);
+    EXPECT_EQ(slots[1], 4);
+    reader.release(2);
+    slots = reader.peek();
+    ASSERT_EQ(slots.size(), 2u);
+    EXPECT_EQ(slots[0], 5);
+    EXPECT_EQ(slots[1], 6);
+    reader.release(2);
+    EXPECT_TRUE(reader.peek().empty());
+
+    // overruns are skipped
+    std::vector<int> values(2 * N + 2);
+    std::iota(values.begin(), values.end(), 100);
+    writer.write(values);
+    slots = reader.peek();
+    ASSERT_EQ(slots.size(), 1u);
+    EXPECT_EQ(slots[0], values[values.size() - N]);
+    reader.release(slots.size());
+    slots = reader.peek();
+    ASSERT_EQ(slots.size(), 4u);
+    EXPECT_EQ(slots[3], values.back());
+}
+
+TEST(CircularTest, torn_elements_are_dropped) {
+    constexpr uint32_t N = 4;
+    constexpr uint64_t KEY = 0x7042;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+
+    // a writer stopped while writing position 4, which reuses the slot of position 0
+    writer.write(std::vector{ 0, 1, 2, 3 });
+    buffer_data->claim_head = { 1, 1 };
+    int value = -1;
+    size_t dropped = 0;
+    EXPECT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 1);
+    EXPECT_EQ(dropped, 1u);
+
+    // a batch being written over the slots of positions 2 and 3
+    writer.write(std::vector{ 4, 5 });
+    buffer_data->claim_head = { 0, 2 };
+    std::vector<int> values(N);
+    EXPECT_EQ(reader.read(values, dropped), 2u);
+    EXPECT_EQ(values[0], 4);
+    EXPECT_EQ(values[1], 5);
+    EXPECT_EQ(dropped, 2u);
+    EXPECT_EQ(buffer_data->reader_stats.read, 3u);
+    EXPECT_EQ(buffer_data->reader_stats.dropped, 3u);
+
+    // slots overwritten while peeked at are not counted as read
+    writer.write(std::vector{ 6, 7, 8 });
+    const auto slots = reader.peek();
+    ASSERT_EQ(slots.size(), 2u);
+    buffer_data->claim_head = { 3, 2 };
+    EXPECT_EQ(reader.release(slots.size()), 1u);
+    EXPECT_EQ(buffer_data->reader_stats.read, 4u);
+    EXPECT_EQ(buffer_data->reader_stats.dropped, 4u);
+
+    // a claim that cannot belong to the writer resets the buffer
+    buffer_data->claim_head = { 0, 9 };
+    CircularWriter<int, N> other(buffer, KEY);
+    EXPECT_EQ(buffer_data->write_head, Head({ 0, 0 }));
+    EXPECT_EQ(buffer_data->claim_head, Head({ 0, 0 }));
+}
+
+TEST(CircularTest, torn_read_leaves_value_unchanged) {
+    constexpr uint32_t N = 4;
+    constexpr uint64_t KEY = 0x7045;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularReader<int, N> reader(buffer, KEY);
+    CircularBroadcastReader<int, N> broadcast(buffer, KEY);
+
+    writer.write(std::vector{ 1, 2, 3, 4 });
+    int value = 0;
+    for (int i = 1; i <= 3; ++i) {
+        ASSERT_TRUE(reader.read(value));
+        ASSERT_TRUE(broadcast.read(value));
+    }
+    // the writer is rewriting every slot, including the last unread one
+    for (auto& slot : writer.claim(N)) {
+        slot = -99;
+    }
+    value = 12345;
+    size_t dropped = 0;
+    EXPECT_FALSE(reader.read(value, dropped));
+    EXPECT_EQ(value, 12345);
+    EXPECT_EQ(dropped, 1u);
+    EXPECT_FALSE(broadcast.read(value, dropped));
+    EXPECT_EQ(value, 12345);
+    EXPECT_EQ(dropped, 1u);
+}
+
+TEST(CircularTest, concurrent_overruns_never_return_torn_elements) {
+    constexpr uint32_t N = 2;
+    constexpr uint64_t KEY = 0x7043;
+    struct Wide {
+        uint64_t value;
+        uint64_t padding[6];
+        uint64_t complement;
+    };
+    uint8_t buffer[Circular<Wide, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<Wide, N>(buffer, KEY);
+
+    std::atomic<bool> stop = false;
+    std::thread producer([&] {
+        // never throttled, so that it keeps lapping the reader
+        CircularWriter<Wide, N> writer(buffer, KEY);
+        for (uint64_t i = 0; not stop.load(std::memory_order_relaxed); ++i) {
+            writer.write({ i, {}, ~i });
+        }
+    });
+
+    CircularReader<Wide, N> reader(buffer, KEY);
+    uint64_t errors = 0;
+    uint64_t read = 0;
+    // bounded in time since a single core only lets the reader in between writer time slices
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    while (read < 100'000 && std::chrono::steady_clock::now() < deadline) {
+        Wide wide;
+        if (reader.read(wide)) {
+            errors += wide.value != ~wide.complement;
+            ++read;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    producer.join();
+
+    EXPECT_GT(read, 0u);
+    EXPECT_EQ(errors, 0u);
+}
+
+TEST(CircularTest, padded_overrun_refreshes_cached_write_head) {
+    constexpr uint32_t N = 4;
+    constexpr uint64_t KEY = 0x7044;
+    using BufferDataT = BufferDataPadded<int, N>;
+    alignas(CACHE_LINE_SIZE) uint8_t buffer[PaddedCircularWriter<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto buffer_data = reinterpret_cast<BufferDataT*>(buffer);
+
+    PaddedCircularWriter<int, N> writer(buffer, KEY);
+    PaddedCircularReader<int, N> reader(buffer, KEY);
+
+    writer.write(std::vector{ 0, 1, 2, 3 });
+    int value = -1;
+    size_t dropped = 0;
+    ASSERT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 0, 1 }));
+
+    // the cached write head still shows 1 to 3, but their slots hold 5 to 7 now
+    writer.write(std::vector{ 4, 5, 6, 7 });
+    ASSERT_TRUE(reader.read(value, dropped));
+    EXPECT_EQ(value, 4);
+    EXPECT_EQ(dropped, 3u);
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 0, 2 }));
+
+    // the same for a batch read
+    writer.write(std::vector{ 8, 9, 10, 11, 12, 13, 14, 15 });
+    std::vector<int> values(2, -1);
+    EXPECT_EQ(reader.read(values, dropped), 2u);
+    EXPECT_EQ(values, std::vector({ 12, 13 }));
+    EXPECT_EQ(dropped, 7u);
+    EXPECT_EQ(buffer_data->write_head_cache, Head({ 0, 4 }));
+    EXPECT_EQ(buffer_data->reader_stats.read, 4u);
+    EXPECT_EQ(buffer_data->reader_stats.dropped, 10u);
+}
+
+TEST(CircularTest, broadcast_readers_see_everything) {
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    writer.write(-1); // before the readers exist
+
+    CircularBroadcastReader<int, N> reader1(buffer, KEY);
+    CircularBroadcastReader<int, N> reader2(buffer, KEY);
+    CircularReader<int, N> shared(buffer, KEY);
+
+    int value = 0;
+    EXPECT_FALSE(reader1.read(value));
+    EXPECT_FALSE(reader2.read(value));
+
+    writer.write(std::vector{ 0, 1, 2, 3, 4 });
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(reader1.read(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(reader1.read(value));
+    // the shared read head is not used by broadcast readers
+    EXPECT_EQ(buffer_data->read_head, Head({ 0, 0 }));
+
+    std::vector<int> values(10);
+    ASSERT_EQ(reader2.read(values), 5u);
+    values.resize(5);
+    EXPECT_EQ(values, std::vector({ 0, 1, 2, 3, 4 }));
+
+    // the shared reader is independent from the broadcast ones
+    ASSERT_TRUE(shared.read(value));
+    EXPECT_EQ(value, -1);
+
+    writer.write(5);
+    ASSERT_TRUE(reader2.read(value));
+    EXPECT_EQ(value, 5);
+    ASSERT_TRUE(reader1.read(value));
+    EXPECT_EQ(value, 5);
+}
+
+TEST(CircularTest, broadcast_reader_overrun) {
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+
+    CircularWriter<int, N> writer(buffer, KEY);
+    CircularBroadcastReader<int, N> slow(buffer, KEY);
+    CircularBroadcastReader<int, N> fast(buffer, KEY);
+
+    std::vector<int> values(3 * N + 2);
+    std::iota(values.begin(), values.end(), 0);
+    for (const auto v : values) {
+        writer.write(v);
+        int value;
+        ASSERT_TRUE(fast.read(value));
+        EXPECT_EQ(value, v);
+    }
+
+    for (uint32_t i = 0; i < N; ++i) {
+        int value;
+        ASSERT_TRUE(slow.read(value));
+        EXPECT_EQ(value, values[values.size() - N + i]);
+    }
+    int value;
+    EXPECT_FALSE(slow.read(value));
+}
+
+TEST(CircularTest, broadcast_concurrent_in_order) {
+    constexpr uint32_t N = 64;
+    constexpr uint64_t KEY = 0x4321;
+    constexpr size_t READERS = 3;
+    uint8_t buffer[Circular<Sequence, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<Sequence, N>(buffer, KEY);
+
+    constexpr uint64_t TOTAL = 50'000;
+    std::atomic<uint64_t> consumed[READERS] = {};
+    std::atomic<uint64_t> errors = 0;
+
+    // readers must exist before the first write so that they see it
+    std::vector<std::unique_ptr<CircularBroadcastReader<Sequence, N>>> readers;
+    for (size_t r = 0; r < READERS; ++r) {
+        readers.push_back(std::make_unique<CircularBroadcastReader<Sequence, N>>(buffer, KEY));
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t r = 0; r < READERS; ++r) {
+        threads.emplace_back([&, r] {
+            for (uint64_t i = 0; i < TOTAL; ++i) {
+                Sequence sequence;
+                while (not readers[r]->read(sequence)) {
+                    std::this_thread::yield();
+                }
+                errors += sequence.value != i || sequence.complement != ~i;
+                consumed[r].store(i + 1, std::memory_order_release);
+            }
+        });
+    }
+
+    CircularWriter<Sequence, N> writer(buffer, KEY);
+    for (uint64_t i = 0; i < TOTAL; ++i) {
+        for (const auto& reader_consumed : consumed) {
+            while (i - reader_consumed.load(std::memory_order_acquire) >= N - 1) {
+                std::this_thread::yield();
+            }
+        }
+        writer.write({ i, ~i });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors, 0u);
+}
+
+namespace {
+template <typename READER>
+concept CanWait = requires(READER& reader, typename READER::TYPE& value) {
+    reader.read_wait(value, std::chrono::nanoseconds(1));
+};
+} // namespace
+
+TEST(CircularTest, read_wait_times_out) {
+    using namespace std::chrono_literals;
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    // only the readers of a buffer whose writer wakes them up can block
+    static_assert(not CanWait<CircularReader<int, N>>);
+    static_assert(not CanWait<CircularBroadcastReader<int, N>>);
+    static_assert(CanWait<BlockingCircularReader<int, N>>);
+    static_assert(CanWait<BlockingCircularBroadcastReader<int, N>>);
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+
+    BlockingCircularWriter<int, N> writer(buffer, KEY);
+    BlockingCircularReader<int, N> reader(buffer, KEY);
+
+    int value = -1;
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_FALSE(reader.read_wait(value, 20ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, 20ms);
+    EXPECT_EQ(value, -1);
+
+    // available values are returned without blocking
+    writer.write(1);
+    EXPECT_TRUE(reader.read_wait(value, 0ms));
+    EXPECT_EQ(value, 1);
+}
+
+TEST(CircularTest, blocking_mismatch_resets_the_buffer) {
+    using namespace std::chrono_literals;
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+    EXPECT_EQ(buffer_data->blocking, 0u);
+
+    BlockingCircularReader<int, N> reader(buffer, KEY);
+    EXPECT_EQ(buffer_data->blocking, 1u);
+    BlockingCircularWriter<int, N> writer(buffer, KEY);
+    writer.write(1);
+
+    // a writer that would never wake the reader resets the buffer as another key would
+    CircularWriter<int, N> plain(buffer, KEY);
+    EXPECT_EQ(buffer_data->blocking, 0u);
+    EXPECT_EQ(buffer_data->write_head, Head({ 0, 0 }));
+
+    // and the reader does not wait for a wake-up that cannot come
+    int value = -1;
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_FALSE(reader.read_wait(value, 10s));
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, 1s);
+    EXPECT_EQ(buffer_data->waiters, 0u);
+}
+
+TEST(CircularTest, read_wait_woken_by_writer) {
+    using namespace std::chrono_literals;
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    using BufferDataT = BufferData<int, N>;
+    uint8_t buffer[Circular<int, N>::MIN_BUFFER_SIZE];
+    initialize_buffer<int, N>(buffer, KEY);
+    auto buffer_data = reinterpret_cast<BufferDataT*>(Circular<int, N>::aligned_in_buffer(buffer));
+
+    BlockingCircularReader<int, N> reader(buffer, KEY);
+    BlockingCircularBroadcastReader<int, N> broadcast(buffer, KEY);
+
+    std::thread producer([&buffer] {
+        BlockingCircularWriter<int, N> writer(buffer, KEY);
+        for (int i = 0; i < 100; ++i) {
+            std::this_thread::sleep_for(100us);
+            writer.write(i);
+        }
+    });
+    std::thread consumer([&broadcast] {
+        for (int i = 0; i < 100; ++i) {
+            int value = -1;
+            EXPECT_TRUE(broadcast.read_wait(value, 10s));
+            EXPECT_EQ(value, i);
+        }
+    });
+    for (int i = 0; i < 100; ++i) {
+        int value = -1;
+        EXPECT_TRUE(reader.read_wait(value, 10s));
+        EXPECT_EQ(value, i);
+    }
+    producer.join();
+    consumer.join();
+    EXPECT_EQ(buffer_data->waiters, 0u);
+}
+
+TEST(CircularTest, read_wait_across_processes) {
+    using namespace std::chrono_literals;
+    constexpr uint32_t N = 7;
+    constexpr uint64_t KEY = 0xabcd;
+    constexpr auto SIZE = Circular<int, N>::MIN_BUFFER_SIZE;
+    void* shared = ::mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(shared, MAP_FAILED);
+    auto buffer = static_cast<uint8_t*>(shared);
+    BlockingCircularReader<int, N> reader(buffer, KEY);
+
+    const auto pid = ::fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        BlockingCircularWriter<int, N> writer(buffer, KEY);
+        std::this_thread::sleep_for(50ms);
+        writer.write(42);
+        ::_exit(0);
+    }
+
+    int value = -1;
+    EXPECT_TRUE(reader.read_wait(value, 10s));
+    EXPECT_EQ(value, 42);
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    ::munmap(shared, SIZE);
 }
 } // namespace brasa::buffer::detail
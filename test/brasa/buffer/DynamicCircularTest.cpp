@@ -0,0 +1,143 @@
+#include <brasa/buffer/DynamicCircular.h>
+#include <brasa/buffer/DynamicCircularReader.h>
+#include <brasa/buffer/DynamicCircularWriter.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace brasa::buffer::detail {
+
+namespace {
+
+DynamicBufferHeader* header(uint8_t* buffer) {
+    return reinterpret_cast<DynamicBufferHeader*>(DynamicCircular<int>::aligned_in_buffer(buffer));
+}
+} // namespace
+
+TEST(DynamicCircularTest, round_capacity) {
+    EXPECT_EQ(DynamicCircular<int>::round_capacity(0), 2u);
+    EXPECT_EQ(DynamicCircular<int>::round_capacity(2), 2u);
+    EXPECT_EQ(DynamicCircular<int>::round_capacity(3), 4u);
+    EXPECT_EQ(DynamicCircular<int>::round_capacity(1000), 1024u);
+    EXPECT_EQ(DynamicCircular<int>::round_capacity(1024), 1024u);
+    EXPECT_GE(
+          DynamicCircular<int>::min_buffer_size(1000),
+          sizeof(DynamicBufferHeader) + 1024 * sizeof(int));
+}
+
+TEST(DynamicCircularTest, create_uninitialized) {
+    constexpr uint64_t KEY = 0x1234;
+    std::vector<uint8_t> buffer(DynamicCircular<int>::min_buffer_size(5));
+    ::memset(buffer.data(), 0x55, buffer.size());
+
+    // a reader cannot attach to an uninitialised buffer
+    EXPECT_THROW(DynamicCircularReader<int>(buffer.data(), KEY), std::invalid_argument);
+
+    const DynamicCircularWriter<int> writer(buffer.data(), 5, KEY);
+    EXPECT_EQ(writer.capacity(), 8u);
+    const auto data = header(buffer.data());
+    EXPECT_EQ(data->write_position, 0u);
+    EXPECT_EQ(data->read_position, 0u);
+    EXPECT_EQ(data->key, KEY);
+    EXPECT_EQ(data->crc, crc32(KEY));
+    EXPECT_EQ(data->capacity, 8u);
+    EXPECT_EQ(data->element_size, sizeof(int));
+
+    const DynamicCircularReader<int> reader(buffer.data(), KEY);
+    EXPECT_EQ(reader.capacity(), 8u);
+
+    // wrong key or element type
+    EXPECT_THROW(DynamicCircularReader<int>(buffer.data(), KEY + 1), std::invalid_argument);
+    EXPECT_THROW(DynamicCircularReader<uint64_t>(buffer.data(), KEY), std::invalid_argument);
+}
+
+TEST(DynamicCircularTest, create_initialized) {
+    constexpr uint64_t KEY = 0x1234;
+    std::vector<uint8_t> buffer(DynamicCircular<int>::min_buffer_size(16));
+
+    { // scope for the first writer
+        DynamicCircularWriter<int> writer(buffer.data(), 16, KEY);
+        writer.write(1);
+    }
+    { // same capacity: the content is kept
+        DynamicCircularWriter<int> writer(buffer.data(), 16, KEY);
+        DynamicCircularReader<int> reader(buffer.data(), KEY);
+        int value = 0;
+        EXPECT_TRUE(reader.read(value));
+        EXPECT_EQ(value, 1);
+        writer.write(2);
+    }
+    // a different capacity resets the buffer
+    DynamicCircularWriter<int> writer(buffer.data(), 4, KEY);
+    DynamicCircularReader<int> reader(buffer.data(), KEY);
+    EXPECT_EQ(reader.capacity(), 4u);
+    int value = 0;
+    EXPECT_FALSE(reader.read(value));
+}
+
+TEST(DynamicCircularTest, write_read_and_overrun) {
+    constexpr uint64_t KEY = 0x1234;
+    std::vector<uint8_t> buffer(DynamicCircular<int>::min_buffer_size(8));
+    DynamicCircularWriter<int> writer(buffer.data(), 8, KEY);
+    DynamicCircularReader<int> reader(buffer.data(), KEY);
+
+    int value = -1;
+    EXPECT_FALSE(reader.read(value));
+    EXPECT_EQ(value, -1);
+    for (int i = 0; i < 8; ++i) {
+        writer.write(i);
+    }
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(reader.read(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(reader.read(value));
+
+    // 3 laps and 3 elements: only the last 8 are read
+    for (int i = 0; i < 27; ++i) {
+        writer.write(100 + i);
+    }
+    for (int i = 19; i < 27; ++i) {
+        EXPECT_TRUE(reader.read(value));
+        EXPECT_EQ(value, 100 + i);
+    }
+    EXPECT_FALSE(reader.read(value));
+}
+
+TEST(DynamicCircularTest, concurrent_in_order) {
+    constexpr uint64_t KEY = 0x4321;
+    constexpr uint64_t TOTAL = 100'000;
+    constexpr std::size_t CAPACITY = 64;
+    std::vector<uint8_t> buffer(DynamicCircular<uint64_t>::min_buffer_size(CAPACITY));
+    DynamicCircularWriter<uint64_t> writer(buffer.data(), CAPACITY, KEY);
+    std::atomic<uint64_t> consumed = 0;
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < TOTAL; ++i) {
+            // throttles the writer so that it never overruns the reader
+            while (i - consumed.load(std::memory_order_acquire) >= CAPACITY - 1) {
+                std::this_thread::yield();
+            }
+            writer.write(i);
+        }
+    });
+
+    DynamicCircularReader<uint64_t> reader(buffer.data(), KEY);
+    uint64_t errors = 0;
+    for (uint64_t i = 0; i < TOTAL; ++i) {
+        uint64_t value;
+        while (not reader.read(value)) {
+            std::this_thread::yield();
+        }
+        errors += value != i;
+        consumed.store(i + 1, std::memory_order_release);
+    }
+    producer.join();
+    EXPECT_EQ(errors, 0u);
+}
+} // namespace brasa::buffer::detail
@@ -0,0 +1,136 @@
+#include <brasa/buffer/Journal.h>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace brasa::buffer {
+
+namespace {
+
+constexpr uint64_t KEY = 0x10a2;
+using SmallJournal = Journal<int, 8>;
+
+std::string unique_path(const std::string& test) {
+    const auto name = "brasa_journal_" + test + "_" + std::to_string(::getpid());
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::vector<int> range(const int begin, const int end) {
+    std::vector<int> values;
+    for (int value = begin; value < end; ++value) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+/** Raw view of the buffer of @p journal, as left in the file. */
+detail::BufferData<SmallJournal::Record, 8>& buffer_data(SmallJournal& journal) {
+    return *reinterpret_cast<detail::BufferData<SmallJournal::Record, 8>*>(
+          SmallJournal::Writer::aligned_in_buffer(journal.data()));
+}
+} // namespace
+
+TEST(JournalTest, records_survive_reopening) {
+    const auto path = unique_path("reopen");
+    {
+        SmallJournal journal(path, KEY, { .sync = JournalSync::EVERY, .every = 3 });
+        EXPECT_TRUE(journal.recovered().empty());
+        for (int value = 0; value < 20; ++value) {
+            journal.write(value);
+        }
+    }
+    {
+        SmallJournal journal(path, KEY);
+        EXPECT_EQ(journal.recovered(), range(12, 20));
+        EXPECT_EQ(journal.lost(), 0);
+        journal.write(20);
+        journal.sync();
+    }
+    SmallJournal journal(path, KEY);
+    EXPECT_EQ(journal.recovered(), range(13, 21));
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, reader_attaches_to_the_mapping) {
+    const auto path = unique_path("reader");
+    SmallJournal journal(path, KEY, { .sync = JournalSync::PERIODIC, .period = {} });
+    SmallJournal::Reader reader(journal.data(), KEY);
+    journal.write(7);
+    SmallJournal::Record record;
+    EXPECT_TRUE(reader.read(record));
+    EXPECT_TRUE(record.is_valid());
+    EXPECT_EQ(record.sequence, 0);
+    EXPECT_EQ(record.value, 7);
+    EXPECT_FALSE(reader.read(record));
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, corrupted_records_are_skipped) {
+    const auto path = unique_path("corrupted");
+    {
+        SmallJournal journal(path, KEY);
+        for (int value = 0; value < 5; ++value) {
+            journal.write(value);
+        }
+        // a record only half written to disk
+        buffer_data(journal).data[2].value = 42;
+    }
+    SmallJournal journal(path, KEY);
+    EXPECT_EQ(journal.recovered(), std::vector<int>({ 0, 1, 3, 4 }));
+    EXPECT_EQ(journal.lost(), 1);
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, heads_are_repaired) {
+    const auto path = unique_path("heads");
+    {
+        SmallJournal journal(path, KEY);
+        for (int value = 0; value < 5; ++value) {
+            journal.write(value);
+        }
+        // heads flushed with one more record that did not reach the disk
+        buffer_data(journal).write_head = { .index = 6, .lap = 0 };
+    }
+    {
+        SmallJournal journal(path, KEY);
+        EXPECT_EQ(journal.recovered(), range(0, 5));
+        SmallJournal::Reader reader(journal.data(), KEY);
+        SmallJournal::Record record;
+        EXPECT_FALSE(reader.read(record));
+        journal.write(5);
+        EXPECT_TRUE(reader.read(record));
+        EXPECT_EQ(record.sequence, 5);
+        EXPECT_EQ(record.value, 5);
+    }
+    SmallJournal journal(path, KEY);
+    EXPECT_EQ(journal.recovered(), range(0, 6));
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, other_key_resets_the_file) {
+    const auto path = unique_path("key");
+    {
+        SmallJournal journal(path, KEY);
+        journal.write(1);
+    }
+    {
+        SmallJournal journal(path, KEY + 1);
+        EXPECT_TRUE(journal.recovered().empty());
+        EXPECT_EQ(journal.lost(), 0);
+    }
+    SmallJournal journal(path, KEY);
+    EXPECT_TRUE(journal.recovered().empty());
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, open_failure) {
+    EXPECT_THROW(SmallJournal("/nonexistent/journal", KEY), std::system_error);
+}
+} // namespace brasa::buffer
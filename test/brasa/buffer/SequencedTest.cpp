@@ -0,0 +1,204 @@
+#include <brasa/buffer/Sequenced.h>
+#include <brasa/buffer/SequencedReader.h>
+#include <brasa/buffer/SequencedWriter.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace brasa::buffer::detail {
+
+namespace {
+
+template <typename PARENT>
+class SequencedMock : public PARENT {
+public:
+    using PARENT::BufferDataT;
+};
+
+template <typename TYPE, uint32_t N>
+typename SequencedMock<Sequenced<TYPE, N>>::BufferDataT* buffer_data(uint8_t* buffer) {
+    using BufferDataT = typename SequencedMock<Sequenced<TYPE, N>>::BufferDataT;
+    return reinterpret_cast<BufferDataT*>(Sequenced<TYPE, N>::aligned_in_buffer(buffer));
+}
+
+struct Message {
+    uint32_t producer;
+    uint32_t sequence;
+};
+} // namespace
+
+TEST(SequencedTest, create_uninitialized) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 4;
+    uint8_t buffer[Sequenced<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto data = buffer_data<int, N>(buffer);
+
+    const SequencedWriter<int, N> writer(buffer, KEY);
+    EXPECT_EQ(data->write_position, 0u);
+    EXPECT_EQ(data->read_position, 0u);
+    for (uint32_t i = 0; i < N; ++i) {
+        EXPECT_EQ(data->slots[i].sequence, i);
+    }
+    EXPECT_EQ(data->key, KEY);
+    EXPECT_EQ(data->crc, crc32(KEY));
+}
+
+TEST(SequencedTest, create_initialized) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 4;
+    uint8_t buffer[Sequenced<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    { // scope for the first writer
+        SequencedWriter<int, N> writer(buffer, KEY);
+        EXPECT_TRUE(writer.write(42));
+    }
+    SequencedReader<int, N> reader(buffer, KEY);
+    int value = 0;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 42);
+
+    // a different key resets the buffer
+    SequencedWriter<int, N> writer(buffer, KEY + 1);
+    EXPECT_TRUE(writer.write(43));
+    SequencedReader<int, N> other(buffer, KEY + 1);
+    EXPECT_TRUE(other.read(value));
+    EXPECT_EQ(value, 43);
+    EXPECT_FALSE(other.read(value));
+}
+
+TEST(SequencedTest, compile_time_key) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 4;
+    uint8_t buffer[Sequenced<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0x55, sizeof(buffer));
+    auto data = buffer_data<int, N>(buffer);
+
+    SequencedWriter<int, N> writer(buffer, Key<KEY>{});
+    EXPECT_EQ(data->crc, crc32(KEY));
+    EXPECT_TRUE(writer.write(42));
+    SequencedReader<int, N> reader(buffer, KEY);
+    int value = 0;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 42);
+}
+
+TEST(SequencedTest, write_read_until_full) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 4;
+    uint8_t buffer[Sequenced<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+
+    SequencedWriter<int, N> writer(buffer, KEY);
+    SequencedReader<int, N> reader(buffer, KEY);
+
+    int value = -1;
+    EXPECT_FALSE(reader.read(value));
+    EXPECT_EQ(value, -1);
+
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < int(N); ++i) {
+            EXPECT_TRUE(writer.write(lap * 10 + i));
+        }
+        EXPECT_FALSE(writer.write(-1)); // full: the oldest element is kept
+        for (int i = 0; i < int(N); ++i) {
+            EXPECT_TRUE(reader.read(value));
+            EXPECT_EQ(value, lap * 10 + i);
+        }
+        EXPECT_FALSE(reader.read(value));
+    }
+}
+
+TEST(SequencedTest, crashed_writer_needs_a_new_key) {
+    constexpr uint64_t KEY = 0x1234;
+    constexpr uint32_t N = 4;
+    uint8_t buffer[Sequenced<int, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    auto data = buffer_data<int, N>(buffer);
+
+    { // scope for the writer that dies after claiming position 1
+        SequencedWriter<int, N> writer(buffer, KEY);
+        EXPECT_TRUE(writer.write(1));
+        data->write_position = 2;
+    }
+
+    // the same key attaches to the stuck buffer
+    SequencedWriter<int, N> writer(buffer, KEY);
+    SequencedReader<int, N> reader(buffer, KEY);
+    EXPECT_TRUE(writer.write(3));
+    int value = 0;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_FALSE(reader.read(value)); // position 1 is never published
+
+    // a new key starts over
+    SequencedWriter<int, N> new_writer(buffer, KEY + 1);
+    SequencedReader<int, N> new_reader(buffer, KEY + 1);
+    EXPECT_TRUE(new_writer.write(4));
+    EXPECT_TRUE(new_reader.read(value));
+    EXPECT_EQ(value, 4);
+}
+
+TEST(SequencedTest, concurrent_producers_and_consumers) {
+    constexpr uint64_t KEY = 0x4321;
+    constexpr uint32_t N = 64;
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t CONSUMERS = 2;
+    constexpr uint32_t PER_PRODUCER = 20'000;
+    uint8_t buffer[Sequenced<Message, N>::MIN_BUFFER_SIZE];
+    ::memset(buffer, 0, sizeof(buffer));
+    SequencedWriter<Message, N> initializer(buffer, KEY);
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&buffer, p] {
+            SequencedWriter<Message, N> writer(buffer, KEY);
+            for (uint32_t i = 0; i < PER_PRODUCER; ++i) {
+                while (not writer.write({ p, i })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::atomic<uint32_t> consumed = 0;
+    std::atomic<uint32_t> errors = 0;
+    std::vector<std::vector<uint32_t>> counts(CONSUMERS, std::vector<uint32_t>(PRODUCERS));
+    for (uint32_t c = 0; c < CONSUMERS; ++c) {
+        threads.emplace_back([&, c] {
+            SequencedReader<Message, N> reader(buffer, KEY);
+            // each consumer sees the messages of a producer in increasing order
+            std::vector<int64_t> last(PRODUCERS, -1);
+            while (consumed.load() < PRODUCERS * PER_PRODUCER) {
+                Message message;
+                if (not reader.read(message)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                errors += message.producer >= PRODUCERS
+                          || int64_t(message.sequence) <= last[message.producer];
+                last[message.producer % PRODUCERS] = message.sequence;
+                ++counts[c][message.producer % PRODUCERS];
+                ++consumed;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors, 0u);
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        uint32_t total = 0;
+        for (uint32_t c = 0; c < CONSUMERS; ++c) {
+            total += counts[c][p];
+        }
+        EXPECT_EQ(total, PER_PRODUCER);
+    }
+}
+} // namespace brasa::buffer::detail
@@ -0,0 +1,117 @@
+#include <brasa/buffer/SharedRing.h>
+
+#include <gtest/gtest.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <system_error>
+
+namespace brasa::buffer {
+
+namespace {
+
+constexpr uint64_t KEY = 0x5ed0;
+using SmallRing = SharedRing<int, 16>;
+using LargeRing = SharedRing<int, 1024>;
+
+std::string unique_name(const std::string& test) {
+    return "/brasa_" + test + "_" + std::to_string(::getpid());
+}
+} // namespace
+
+TEST(SharedRingTest, writer_and_reader_share_the_segment) {
+    const auto name = unique_name("share");
+    { // scope for the rings
+        SmallRing first(name);
+        EXPECT_GE(first.size(), SmallRing::Writer::MIN_BUFFER_SIZE);
+        auto writer = first.writer(KEY);
+        writer.write(1);
+        writer.write(2);
+
+        // attaching to the existing segment keeps its content
+        SmallRing second(name);
+        EXPECT_NE(first.data(), second.data());
+        auto reader = second.reader(KEY);
+        int value = 0;
+        EXPECT_TRUE(reader.read(value));
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(reader.read(value));
+        EXPECT_EQ(value, 2);
+        EXPECT_FALSE(reader.read(value));
+    }
+    EXPECT_TRUE(SmallRing::unlink(name));
+    EXPECT_FALSE(SmallRing::unlink(name));
+}
+
+TEST(SharedRingTest, options) {
+    const auto name = unique_name("options");
+    SharedRing<int, 1024, detail::BufferDataPadded> ring(
+          name,
+          { .populate = true, .lock = false, .huge_pages = false });
+    auto writer = ring.writer(KEY);
+    auto reader = ring.reader(KEY);
+    writer.write(3);
+    int value = 0;
+    EXPECT_TRUE(reader.read(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_TRUE(LargeRing::unlink(name));
+}
+
+TEST(SharedRingTest, lock) {
+    // mlock needs CAP_IPC_LOCK or a large enough RLIMIT_MEMLOCK, often missing in containers
+    rlimit limit{};
+    ASSERT_EQ(::getrlimit(RLIMIT_MEMLOCK, &limit), 0);
+    if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < LargeRing::Writer::MIN_BUFFER_SIZE) {
+        GTEST_SKIP() << "RLIMIT_MEMLOCK is " << limit.rlim_cur << " bytes";
+    }
+    const auto name = unique_name("lock");
+    { // scope for the ring
+        LargeRing ring(name, { .lock = true });
+        auto writer = ring.writer(KEY);
+        writer.write(4);
+        int value = 0;
+        EXPECT_TRUE(ring.reader(KEY).read(value));
+        EXPECT_EQ(value, 4);
+    }
+    EXPECT_TRUE(LargeRing::unlink(name));
+}
+
+TEST(SharedRingTest, huge_pages_round_the_size) {
+    const auto name = unique_name("huge");
+    try {
+        LargeRing ring(name, { .huge_pages = true });
+        EXPECT_EQ(ring.size(), LargeRing::HUGE_PAGE_SIZE);
+    } catch (const std::system_error& error) {
+        // the kernel may not support huge pages for shared memory
+        GTEST_LOG_(INFO) << error.what();
+    }
+    LargeRing::unlink(name);
+}
+
+TEST(SharedRingTest, blocking_views_with_compile_time_key) {
+    const auto name = unique_name("blocking");
+    using Ring = BlockingSharedRing<int, 16>;
+    { // scope for the ring
+        Ring ring(name);
+        auto writer = ring.writer(Key<KEY>{});
+        auto reader = ring.reader(Key<KEY>{});
+        auto broadcast = ring.broadcast_reader(KEY);
+        int value = 0;
+        EXPECT_FALSE(reader.read_wait(value, std::chrono::milliseconds(1)));
+
+        writer.write(5);
+        EXPECT_TRUE(reader.read_wait(value, std::chrono::milliseconds(1)));
+        EXPECT_EQ(value, 5);
+        EXPECT_TRUE(broadcast.read_wait(value, std::chrono::milliseconds(1)));
+        EXPECT_EQ(value, 5);
+    }
+    EXPECT_TRUE(Ring::unlink(name));
+}
+
+TEST(SharedRingTest, invalid_name_throws) {
+    EXPECT_THROW(SmallRing("/not/valid"), std::system_error);
+}
+} // namespace brasa::buffer
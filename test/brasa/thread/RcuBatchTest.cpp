@@ -0,0 +1,111 @@
+#include <brasa/chronus/Now.h>
+#include <brasa/thread/RcuBatch.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace brasa::thread::test {
+
+TEST(RcuBatchTest, mutations_are_published_together) {
+    Rcu<std::string> rcu("a");
+    auto batch = make_rcu_batch(rcu, chronus::milli_now, 60'000);
+    EXPECT_EQ(batch.push([](std::string& s) { s += "b"; }), 0u);
+    EXPECT_EQ(batch.push([](std::string& s) { s += "c"; }), 0u);
+    EXPECT_EQ(batch.pending(), 2u);
+    EXPECT_EQ(rcu.read().value(), "a");
+
+    EXPECT_EQ(batch.flush(), 2u);
+    EXPECT_EQ(batch.pending(), 0u);
+    EXPECT_EQ(rcu.read().value(), "abc");
+    EXPECT_EQ(rcu.current_epoch(), 1u); // a single version for the batch
+    EXPECT_EQ(batch.flush(), 0u);
+    EXPECT_EQ(rcu.current_epoch(), 1u);
+}
+
+TEST(RcuBatchTest, window_publishes_on_push) {
+    Rcu<int> rcu(0);
+    uint64_t time = 100;
+    auto batch = make_rcu_batch(rcu, [&time] { return time; }, uint64_t(10));
+    EXPECT_EQ(batch.push([](int& i) { i += 1; }), 0u);
+    time = 109;
+    EXPECT_EQ(batch.push([](int& i) { i *= 10; }), 0u);
+    EXPECT_EQ(batch.flush_if_due(), 0u);
+    EXPECT_EQ(rcu.read().value(), 0);
+
+    time = 110;
+    EXPECT_EQ(batch.push([](int& i) { i += 2; }), 3u);
+    EXPECT_EQ(rcu.read().value(), 12);
+
+    // the window starts again with the next mutation
+    time = 115;
+    EXPECT_EQ(batch.push([](int& i) { i += 3; }), 0u);
+    time = 124;
+    EXPECT_EQ(batch.flush_if_due(), 0u);
+    time = 125;
+    EXPECT_EQ(batch.flush_if_due(), 1u);
+    EXPECT_EQ(rcu.read().value(), 15);
+}
+
+TEST(RcuBatchTest, max_pending_publishes_on_push) {
+    Rcu<int> rcu(0);
+    auto batch = make_rcu_batch(rcu, [] { return 0; }, 1, 3);
+    EXPECT_EQ(batch.push([](int& i) { ++i; }), 0u);
+    EXPECT_EQ(batch.push([](int& i) { ++i; }), 0u);
+    EXPECT_EQ(batch.push([](int& i) { ++i; }), 3u);
+    EXPECT_EQ(rcu.read().value(), 3);
+}
+
+TEST(RcuBatchTest, destruction_publishes) {
+    Rcu<int> rcu(0);
+    { // scope for the batch
+        auto batch = make_rcu_batch(rcu, chronus::milli_now, 60'000);
+        batch.push([](int& i) { i = 7; });
+        EXPECT_EQ(rcu.read().value(), 0);
+    }
+    EXPECT_EQ(rcu.read().value(), 7);
+}
+
+TEST(RcuBatchTest, throwing_mutation_publishes_the_previous_ones) {
+    Rcu<int> rcu(0);
+    auto batch = make_rcu_batch(rcu, chronus::milli_now, 60'000);
+    batch.push([](int& i) { i = 1; });
+    batch.push([](int&) { throw std::runtime_error("mutation"); });
+    batch.push([](int& i) { i = 3; });
+    EXPECT_THROW(batch.flush(), std::runtime_error);
+    EXPECT_EQ(batch.pending(), 0u);
+    EXPECT_EQ(rcu.read().value(), 1);
+}
+
+TEST(RcuBatchTest, concurrent_pushes) {
+    Rcu<std::vector<int>> rcu({});
+    { // scope for the batch
+        auto batch = make_rcu_batch(rcu, chronus::micro_now, 100, 50);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&batch, t] {
+                for (int i = 0; i < 1000; ++i) {
+                    batch.push([value = t * 1000 + i](std::vector<int>& v) { v.push_back(value); });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    const auto reader = rcu.read();
+    const auto& values = reader.value();
+    ASSERT_EQ(values.size(), 4000u);
+    // the mutations of each thread are applied in the order they were pushed
+    std::vector<int> last(4, -1);
+    for (const auto value : values) {
+        EXPECT_GT(value % 1000, last[value / 1000]);
+        last[value / 1000] = value % 1000;
+    }
+}
+
+} // namespace brasa::thread::test
@@ -5,6 +5,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <type_traits>
 
 namespace brasa::thread::test {
@@ -12,7 +13,9 @@ namespace {
 template <typename T>
 class PoolMock {
 public:
-    MOCK_METHOD(void, release, (const T*), (const));
+    using Handle = const T*;
+    MOCK_METHOD(void, release, (Handle), (const));
+    MOCK_METHOD(uint64_t, epoch, (Handle), (const));
 };
 } // namespace
 
@@ -21,7 +24,7 @@ TEST(RcuReaderTest, check_relase_is_called) {
     const int value = 67;
     EXPECT_CALL(pool, release(&value)).Times(1);
     { // scope for the reader
-        const RcuReader<int, PoolMock<int>> reader(&value, &pool);
+        const RcuReader<int, PoolMock<int>> reader(&value, &value, &pool);
         EXPECT_EQ(reader.value(), 67);
     }
 }
@@ -30,13 +33,13 @@ TEST(RcuReaderTest, check_validity) {
     const PoolMock<int> pool;
     const int value = 67;
     EXPECT_CALL(pool, release(&value)).Times(1);
-    const RcuReader<int, PoolMock<int>> valid(&value, &pool);
+    const RcuReader<int, PoolMock<int>> valid(&value, &value, &pool);
     EXPECT_TRUE(valid.is_valid());
-    const RcuReader<int, PoolMock<int>> invalid1(nullptr, &pool);
+    const RcuReader<int, PoolMock<int>> invalid1(nullptr, nullptr, &pool);
     EXPECT_FALSE(invalid1.is_valid());
-    const RcuReader<int, PoolMock<int>> invalid2(&value, nullptr);
+    const RcuReader<int, PoolMock<int>> invalid2(&value, &value, nullptr);
     EXPECT_FALSE(invalid2.is_valid());
-    const RcuReader<int, PoolMock<int>> invalid3(nullptr, nullptr);
+    const RcuReader<int, PoolMock<int>> invalid3(nullptr, nullptr, nullptr);
     EXPECT_FALSE(invalid3.is_valid());
 }
 
@@ -44,7 +47,7 @@ TEST(RcuReaderTest, check_after_move_object_is_invalid) {
     const PoolMock<int> pool;
     const int value = 67;
     EXPECT_CALL(pool, release(&value)).Times(1);
-    RcuReader<int, PoolMock<int>> first(&value, &pool);
+    RcuReader<int, PoolMock<int>> first(&value, &value, &pool);
     EXPECT_TRUE(first.is_valid());
 
     auto second = std::move(first);
@@ -52,6 +55,15 @@ TEST(RcuReaderTest, check_after_move_object_is_invalid) {
     EXPECT_FALSE(first.is_valid());
 }
 
+TEST(RcuReaderTest, check_epoch_comes_from_the_pool) {
+    const PoolMock<int> pool;
+    const int value = 67;
+    EXPECT_CALL(pool, release(&value)).Times(1);
+    EXPECT_CALL(pool, epoch(&value)).WillOnce(::testing::Return(12));
+    const RcuReader<int, PoolMock<int>> reader(&value, &value, &pool);
+    EXPECT_EQ(reader.epoch(), 12u);
+}
+
 static_assert(std::is_move_constructible_v<RcuReader<int, PoolMock<int>>>);
 static_assert(std::is_move_constructible_v<RcuReader<NonMoveable, PoolMock<NonMoveable>>>);
 static_assert(false == std::is_copy_constructible_v<RcuReader<int, PoolMock<int>>>);
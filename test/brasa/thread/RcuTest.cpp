@@ -3,11 +3,17 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <source_location>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace brasa::thread::test {
 TEST(RcuTest, creation_with_value) {
@@ -38,6 +44,202 @@ TEST(RcuTest, write_value) {
     EXPECT_EQ(rcu.size(), 2u);
 }
 
+TEST(RcuTest, nodes_are_recycled) {
+    Rcu<std::vector<int>> rcu(std::vector<int>(1000, 1));
+    const auto* first = rcu.read().value().data();
+    { // scope for writing: the first version is released at the end
+        auto writer = rcu.write();
+        EXPECT_NE(writer.value().data(), first);
+        writer.value()[0] = 2;
+    }
+    EXPECT_EQ(rcu.size(), 1u);
+    { // scope for writing: the copy is made into the storage of the first version
+        auto writer = rcu.write();
+        EXPECT_EQ(writer.value().data(), first);
+        EXPECT_EQ(writer.value()[0], 2);
+        writer.value()[0] = 3;
+    }
+    EXPECT_EQ(rcu.read().value()[0], 3);
+    EXPECT_EQ(rcu.size(), 1u);
+}
+
+TEST(RcuTest, retired_nodes_wait_for_their_readers) {
+    Rcu<int> rcu(1);
+    auto reader = rcu.read();
+    { // scope for writing
+        auto writer = rcu.write();
+        writer.value() = 2;
+    }
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    EXPECT_EQ(reader.value(), 1);
+    reader = rcu.read();
+    EXPECT_EQ(reader.value(), 2);
+    // reclaimed by the next write
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    rcu.write();
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    EXPECT_EQ(rcu.size(), 2u);
+}
+
+TEST(RcuTest, readers_released_by_other_threads) {
+    Rcu<int> rcu(1);
+    // taken by more threads than there are stripes, and all released by this one
+    std::vector<RcuReader<int, Rcu<int>>> readers;
+    std::mutex readers_mutex;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 2 * detail::READER_STRIPES; ++i) {
+        threads.emplace_back([&] {
+            auto reader = rcu.read();
+            std::lock_guard lock(readers_mutex);
+            readers.push_back(std::move(reader));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    { // scope for writing
+        auto writer = rcu.write();
+        writer.value() = 2;
+    }
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    readers.pop_back();
+    rcu.write();
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    readers.clear();
+    rcu.write();
+    EXPECT_EQ(rcu.pending_retirements(), 0u);
+    EXPECT_EQ(rcu.read().value(), 2);
+}
+
+TEST(RcuTest, more_versions_held_than_a_stripe_counts) {
+    Rcu<int> rcu(0);
+    // held by this thread and released by another one, so some are counted out of the stripes
+    constexpr int VERSIONS = int(2 * detail::REFERENCES_PER_STRIPE + 1);
+    std::vector<RcuReader<int, Rcu<int>>> readers;
+    for (int i = 1; i <= VERSIONS; ++i) {
+        readers.push_back(rcu.read());
+        auto writer = rcu.write();
+        writer.value() = i;
+    }
+    EXPECT_EQ(rcu.pending_retirements(), size_t(VERSIONS));
+    for (int i = 0; i < VERSIONS; ++i) {
+        EXPECT_EQ(readers[i].value(), i);
+    }
+    std::thread([&readers] { readers.erase(readers.begin() + 1, readers.end()); }).join();
+    rcu.write();
+    EXPECT_EQ(rcu.pending_retirements(), 1u);
+    readers.clear();
+    rcu.write();
+    EXPECT_EQ(rcu.pending_retirements(), 0u);
+    EXPECT_EQ(rcu.read().value(), VERSIONS);
+}
+
+TEST(RcuTest, epochs) {
+    Rcu<int> rcu(1);
+    EXPECT_EQ(rcu.current_epoch(), 0u);
+    const auto first = rcu.read();
+    EXPECT_EQ(first.epoch(), 0u);
+    for (int i = 2; i <= 4; ++i) {
+        auto writer = rcu.write();
+        writer.value() = i;
+        EXPECT_EQ(rcu.current_epoch(), uint64_t(i - 2)); // not published yet
+    }
+    EXPECT_EQ(rcu.current_epoch(), 3u);
+    const auto last = rcu.read();
+    EXPECT_EQ(last.epoch(), 3u);
+    EXPECT_EQ(last.value(), 4);
+    EXPECT_EQ(first.epoch(), 0u);
+    EXPECT_EQ(first.value(), 1);
+}
+
+TEST(RcuTest, try_write_and_write_for) {
+    Rcu<int> rcu(1);
+    { // scope for writing
+        auto writer = rcu.write();
+        writer.value() = 2;
+        EXPECT_EQ(rcu.size(), 2u); // does not wait for the writer
+        // the mutex must be tried from another thread than its owner
+        std::thread([&rcu] {
+            EXPECT_FALSE(rcu.try_write().has_value());
+            const auto begin = std::chrono::steady_clock::now();
+            EXPECT_FALSE(rcu.write_for(std::chrono::milliseconds(5)).has_value());
+            EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(5));
+        }).join();
+    }
+    { // scope for writing
+        auto writer = rcu.try_write();
+        ASSERT_TRUE(writer.has_value());
+        EXPECT_EQ(writer->value(), 2);
+        writer->value() = 3;
+    }
+    { // scope for writing
+        auto writer = rcu.write_for(std::chrono::seconds(1));
+        ASSERT_TRUE(writer.has_value());
+        writer->value() = 4;
+    }
+    EXPECT_EQ(rcu.read().value(), 4);
+    EXPECT_EQ(rcu.size(), 1u);
+}
+
+namespace {
+/** Value that records the threads that destroyed its copies. */
+struct Tracked {
+    struct Log {
+        std::mutex mutex;
+        std::vector<std::thread::id> destroyers;
+    };
+    std::shared_ptr<Log> log;
+
+    ~Tracked() {
+        if (log) {
+            std::lock_guard lock(log->mutex);
+            log->destroyers.push_back(std::this_thread::get_id());
+        }
+    }
+};
+
+/** Waits up to a second for @p predicate to hold. */
+template <typename PREDICATE>
+bool eventually(PREDICATE predicate) {
+    for (int i = 0; i < 1000 && not predicate(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return predicate();
+}
+} // namespace
+
+TEST(RcuTest, background_reclamation) {
+    const auto log = std::make_shared<Tracked::Log>();
+    Rcu<Tracked> rcu(
+          Tracked{ log },
+          { .reclaim = RcuReclaim::BACKGROUND,
+            .period = std::chrono::milliseconds(1),
+            .max_free_nodes = 1 });
+    std::vector<RcuReader<Tracked, Rcu<Tracked>>> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.push_back(rcu.read());
+        rcu.write();
+    }
+    EXPECT_EQ(rcu.pending_retirements(), 4u);
+    EXPECT_EQ(rcu.size(), 5u);
+
+    // no other write: the reclaimer frees the versions when their readers are gone
+    const auto destroyed = [&log] {
+        std::lock_guard lock(log->mutex);
+        return log->destroyers.size();
+    };
+    const auto before = destroyed();
+    readers.clear();
+    EXPECT_TRUE(eventually([&] { return rcu.pending_retirements() == 0; }));
+    EXPECT_EQ(rcu.size(), 1u);
+    // one node is kept for the next write, the others are destroyed by the reclaimer
+    ASSERT_TRUE(eventually([&] { return destroyed() == before + 3; }));
+    std::lock_guard lock(log->mutex);
+    for (size_t i = before; i < log->destroyers.size(); ++i) {
+        EXPECT_NE(log->destroyers[i], std::this_thread::get_id());
+    }
+}
+
 namespace {
 template <typename T>
 std::set<T> reader_func(const Rcu<T>& rcu, const std::set<T>& values, std::source_location loc) {
@@ -108,4 +310,38 @@ TEST(RcuTest, concurrent_access_int) {
     concurrent_test(values_int);
 }
 
+TEST(RcuTest, readers_never_see_a_released_value) {
+    // every version is a string of a single repeated character, so a value read while (or after)
+    // it is destroyed is very likely to show up as a mix
+    Rcu<std::string> rcu(std::string(1000, 'a'));
+    std::atomic<bool> stop = false;
+    std::atomic<size_t> reads = 0;
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (not stop) {
+                const auto reader = rcu.read();
+                const auto& value = reader.value();
+                EXPECT_EQ(value, std::string(value.size(), value.front()));
+                ++reads;
+            }
+        });
+    }
+    while (reads == 0) {
+        std::this_thread::yield();
+    }
+    for (size_t i = 0; i < 1000; ++i) {
+        auto writer = rcu.write();
+        writer.value() = std::string(1000 + i, char('a' + i % 26));
+        if (i % 100 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(rcu.read().value(), std::string(1999, char('a' + 999 % 26)));
+}
+
 } // namespace brasa::thread::test